@@ -105,14 +105,19 @@ struct ReadAheadBuffer {
 
 	// Prefetch all read heads
 	void Prefetch() {
+		vector<FileReadRequest> requests;
+		requests.reserve(read_heads.size());
 		for (auto &read_head : read_heads) {
 			read_head.Allocate(allocator);
 
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
-
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			requests.emplace_back(read_head.data.get(), read_head.size, read_head.location);
+		}
+		// issue the reads as a single batch, so that the file system can serve them concurrently
+		handle.BatchRead(requests);
+		for (auto &read_head : read_heads) {
 			read_head.data_isset = true;
 		}
 	}
@@ -379,6 +379,12 @@ int64_t FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Write is not implemented!", GetName());
 }
 
+void FileSystem::BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 int64_t FileSystem::GetFileSize(FileHandle &handle) {
 	throw NotImplementedException("%s: GetFileSize is not implemented!", GetName());
 }
@@ -569,6 +575,10 @@ void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+void FileHandle::BatchRead(const vector<FileReadRequest> &requests) {
+	file_system.BatchRead(*this, requests);
+}
+
 void FileHandle::Seek(idx_t location) {
 	file_system.Seek(*this, location);
 }
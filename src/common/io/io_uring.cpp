@@ -0,0 +1,370 @@
+#include "duckdb/common/io_uring.hpp"
+
+// the amalgamation compiles everything as a single translation unit, which the macros of the kernel headers would
+// leak into
+#if defined(__linux__) && !defined(DUCKDB_DISABLE_IO_URING) && !defined(DUCKDB_AMALGAMATION)
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define DUCKDB_IO_URING_SUPPORTED
+#endif
+#endif
+
+#ifdef DUCKDB_IO_URING_SUPPORTED
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+constexpr const idx_t IOUring::RING_DEPTH;
+
+#ifdef DUCKDB_IO_URING_SUPPORTED
+
+//! A single io_uring instance, i.e. a submission queue and completion queue that are shared with the kernel
+class IOUringInstance {
+public:
+	IOUringInstance() : ring_fd(-1), sq_ring(MAP_FAILED), cq_ring(MAP_FAILED), sqes(nullptr) {
+	}
+	~IOUringInstance() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring != MAP_FAILED) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+	}
+
+	//! Sets up a new ring, returns nullptr if this fails (e.g. because the kernel does not support io_uring)
+	static unique_ptr<IOUringInstance> Create() {
+		auto result = make_uniq<IOUringInstance>();
+		if (!result->Initialize()) {
+			return nullptr;
+		}
+		return result;
+	}
+
+	//! Submits the requests in batches of (at most) the ring depth, and waits for all of them to complete
+	void Read(int fd, vector<FileReadRequest> &requests) {
+		idx_t batch_start = 0;
+		while (batch_start < requests.size()) {
+			const auto batch_count = MinValue<idx_t>(requests.size() - batch_start, sq_entries);
+			// fill the submission queue - we are the only producer, so we can read the tail without synchronization
+			auto tail = *sq_tail;
+			for (idx_t i = 0; i < batch_count; i++) {
+				auto &request = requests[batch_start + i];
+				const auto index = tail & *sq_mask;
+				iovecs[i].iov_base = request.buffer;
+				iovecs[i].iov_len = request.nr_bytes;
+
+				auto &sqe = sqes[index];
+				memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_READV;
+				sqe.fd = fd;
+				sqe.addr = reinterpret_cast<uint64_t>(&iovecs[i]);
+				sqe.len = 1;
+				sqe.off = request.location;
+				sqe.user_data = batch_start + i;
+				sq_array[index] = index;
+				tail++;
+			}
+			// make the entries visible to the kernel
+			__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+			idx_t submitted = 0;
+			idx_t completed = 0;
+			memset(finished, 0, sizeof(finished));
+			while (completed < batch_count) {
+				// submit whatever the kernel has not consumed yet and wait for the remaining completions
+				auto ret = syscall(__NR_io_uring_enter, ring_fd, batch_count - submitted, batch_count - completed,
+				                   IORING_ENTER_GETEVENTS, nullptr, 0);
+				if (ret < 0) {
+					if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+						// make room in the completion queue before trying again
+						completed += Reap(requests, batch_start);
+						continue;
+					}
+					auto error = errno;
+					// the reads that were submitted write into the buffers of the caller: we cannot return before
+					// the kernel is done with them
+					CancelBatch(requests, batch_start, submitted, completed);
+					throw IOException("Could not submit reads to io_uring: %s", strerror(error));
+				}
+				submitted += NumericCast<idx_t>(ret);
+				completed += Reap(requests, batch_start);
+			}
+			batch_start += batch_count;
+		}
+	}
+
+private:
+	//! The user data of the cancellations, which do not correspond to a request
+	static constexpr const uint64_t CANCEL_USER_DATA = ~uint64_t(0);
+
+	//! Reaps the available completions, and returns the number of completed reads
+	idx_t Reap(vector<FileReadRequest> &requests, idx_t batch_start) {
+		idx_t completed = 0;
+		auto head = *cq_head;
+		const auto cq_tail_value = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+		for (; head != cq_tail_value; head++) {
+			auto &cqe = cqes[head & *cq_mask];
+			if (cqe.user_data == CANCEL_USER_DATA) {
+				reaped_cancels++;
+				continue;
+			}
+			auto &request = requests[cqe.user_data];
+			if (cqe.res > 0) {
+				// errors and short reads are completed by the caller
+				const auto bytes_read = NumericCast<idx_t>(cqe.res);
+				request.buffer = static_cast<data_ptr_t>(request.buffer) + bytes_read;
+				request.nr_bytes -= bytes_read;
+				request.location += bytes_read;
+			}
+			finished[cqe.user_data - batch_start] = true;
+			completed++;
+		}
+		__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+		return completed;
+	}
+
+	//! Drops the entries of the batch that were not submitted, cancels the reads that are in flight and waits until
+	//! the kernel has completed all of them. Afterwards, the ring is empty and can be reused.
+	void CancelBatch(vector<FileReadRequest> &requests, idx_t batch_start, idx_t submitted, idx_t completed) {
+		// the kernel only consumes submission queue entries in io_uring_enter, so the entries that it has not consumed
+		// yet can be taken back by resetting the tail
+		auto tail = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+		__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+		// ask the kernel to cancel the reads that are still in flight - the queue is empty now, so there is room for
+		// all of them. Reads that are already being served cannot be cancelled, we have to wait for those.
+		idx_t cancel_count = 0;
+		for (idx_t i = 0; i < submitted; i++) {
+			if (finished[i]) {
+				continue;
+			}
+			const auto index = tail & *sq_mask;
+			auto &sqe = sqes[index];
+			memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_ASYNC_CANCEL;
+			sqe.fd = -1;
+			sqe.addr = batch_start + i;
+			sqe.user_data = CANCEL_USER_DATA;
+			sq_array[index] = index;
+			tail++;
+			cancel_count++;
+		}
+		__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+		idx_t cancels_submitted = 0;
+		reaped_cancels = 0;
+		while (completed < submitted || reaped_cancels < cancels_submitted) {
+			auto ret = syscall(__NR_io_uring_enter, ring_fd, cancel_count - cancels_submitted, 1,
+			                   IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (ret < 0) {
+				if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+					completed += Reap(requests, batch_start);
+					continue;
+				}
+				if (cancels_submitted < cancel_count) {
+					// the cancellations cannot be submitted either: take them back, and only wait for the reads
+					__atomic_store_n(sq_tail, __atomic_load_n(sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+					cancel_count = cancels_submitted;
+					continue;
+				}
+				// we can neither wait for the reads nor stop them - the kernel might still write into buffers that
+				// are about to be freed
+				throw FatalException("Could not wait for the reads that are in flight on io_uring: %s",
+				                     strerror(errno));
+			}
+			cancels_submitted += NumericCast<idx_t>(ret);
+			completed += Reap(requests, batch_start);
+		}
+	}
+
+	bool Initialize() {
+		struct io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		auto fd = syscall(__NR_io_uring_setup, IOUring::RING_DEPTH, &params);
+		if (fd < 0) {
+			return false;
+		}
+		ring_fd = NumericCast<int>(fd);
+		sq_entries = params.sq_entries;
+
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			// the submission and completion queue rings can be mapped at once
+			single_mmap = true;
+			sq_ring_size = MaxValue(sq_ring_size, cq_ring_size);
+			cq_ring_size = sq_ring_size;
+		}
+#endif
+		sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		               IORING_OFF_SQ_RING);
+		if (sq_ring == MAP_FAILED) {
+			return false;
+		}
+		if (single_mmap) {
+			cq_ring = sq_ring;
+		} else {
+			cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+			               IORING_OFF_CQ_RING);
+			if (cq_ring == MAP_FAILED) {
+				return false;
+			}
+		}
+		sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+		auto sqes_ptr =
+		    mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+		if (sqes_ptr == MAP_FAILED) {
+			return false;
+		}
+		sqes = static_cast<struct io_uring_sqe *>(sqes_ptr);
+
+		auto sq_base = static_cast<data_ptr_t>(sq_ring);
+		sq_head = reinterpret_cast<unsigned *>(sq_base + params.sq_off.head);
+		sq_tail = reinterpret_cast<unsigned *>(sq_base + params.sq_off.tail);
+		sq_mask = reinterpret_cast<unsigned *>(sq_base + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(sq_base + params.sq_off.array);
+		auto cq_base = static_cast<data_ptr_t>(cq_ring);
+		cq_head = reinterpret_cast<unsigned *>(cq_base + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(cq_base + params.cq_off.tail);
+		cq_mask = reinterpret_cast<unsigned *>(cq_base + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<struct io_uring_cqe *>(cq_base + params.cq_off.cqes);
+		return true;
+	}
+
+private:
+	int ring_fd;
+	idx_t sq_entries;
+	//! The memory that is shared with the kernel
+	void *sq_ring;
+	size_t sq_ring_size;
+	void *cq_ring;
+	size_t cq_ring_size;
+	struct io_uring_sqe *sqes;
+	size_t sqes_size;
+	//! Pointers into the shared memory
+	unsigned *sq_head;
+	unsigned *sq_tail;
+	unsigned *sq_mask;
+	unsigned *sq_array;
+	unsigned *cq_head;
+	unsigned *cq_tail;
+	unsigned *cq_mask;
+	struct io_uring_cqe *cqes;
+	//! The targets of the reads that are in flight
+	struct iovec iovecs[IOUring::RING_DEPTH];
+	//! Whether or not the reads of the current batch have completed
+	bool finished[IOUring::RING_DEPTH];
+	//! The number of completed cancellations, see CancelBatch
+	idx_t reaped_cancels = 0;
+};
+
+//! Caches the rings, so that they are set up only once and can be reused by any thread
+class IOUringCache {
+public:
+	IOUringCache() : supported(true), enabled(true) {
+	}
+
+	//! Returns an unused ring, or nullptr if io_uring is not supported
+	unique_ptr<IOUringInstance> Acquire() {
+		{
+			lock_guard<mutex> guard(lock);
+			if (!supported || !enabled) {
+				return nullptr;
+			}
+			if (!rings.empty()) {
+				auto result = std::move(rings.back());
+				rings.pop_back();
+				return result;
+			}
+		}
+		auto result = IOUringInstance::Create();
+		if (!result) {
+			// io_uring is not available (old kernel, or it was disabled): do not try again
+			lock_guard<mutex> guard(lock);
+			supported = false;
+		}
+		return result;
+	}
+
+	void Release(unique_ptr<IOUringInstance> ring) {
+		lock_guard<mutex> guard(lock);
+		rings.push_back(std::move(ring));
+	}
+
+	void SetEnabled(bool enabled_p) {
+		lock_guard<mutex> guard(lock);
+		enabled = enabled_p;
+	}
+
+private:
+	mutex lock;
+	bool supported;
+	bool enabled;
+	vector<unique_ptr<IOUringInstance>> rings;
+};
+
+static IOUringCache &GetIOUringCache() {
+	static IOUringCache cache;
+	return cache;
+}
+
+bool IOUring::IsSupported() {
+	auto &cache = GetIOUringCache();
+	auto ring = cache.Acquire();
+	if (!ring) {
+		return false;
+	}
+	cache.Release(std::move(ring));
+	return true;
+}
+
+void IOUring::SetEnabled(bool enabled) {
+	GetIOUringCache().SetEnabled(enabled);
+}
+
+bool IOUring::BatchRead(int fd, vector<FileReadRequest> &requests) {
+	auto &cache = GetIOUringCache();
+	auto ring = cache.Acquire();
+	if (!ring) {
+		return false;
+	}
+	ring->Read(fd, requests);
+	cache.Release(std::move(ring));
+	return true;
+}
+
+#else
+
+bool IOUring::IsSupported() {
+	return false;
+}
+
+void IOUring::SetEnabled(bool enabled) {
+}
+
+bool IOUring::BatchRead(int fd, vector<FileReadRequest> &requests) {
+	return false;
+}
+
+#endif
+
+} // namespace duckdb
@@ -4,6 +4,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
@@ -437,6 +438,20 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) {
+	vector<FileReadRequest> remaining_requests(requests);
+	if (remaining_requests.size() > 1) {
+		// submit the reads at once, so that the device can serve them concurrently
+		IOUring::BatchRead(handle.Cast<UnixFileHandle>().fd, remaining_requests);
+	}
+	// perform the reads that were not (completely) served by io_uring with pread, this also takes care of errors
+	for (auto &request : remaining_requests) {
+		if (request.nr_bytes > 0) {
+			Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+		}
+	}
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -879,6 +894,12 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
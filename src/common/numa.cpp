@@ -0,0 +1,171 @@
+#include "duckdb/common/numa.hpp"
+
+#if defined(__linux__) && !defined(DUCKDB_DISABLE_NUMA)
+#include <sys/syscall.h>
+#if defined(__NR_get_mempolicy)
+#define DUCKDB_NUMA_SUPPORTED
+#endif
+#endif
+
+#ifdef DUCKDB_NUMA_SUPPORTED
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_NUMA_SUPPORTED
+
+//! get_mempolicy flags (see <numaif.h>), we do not depend on libnuma
+static constexpr const unsigned long NUMA_MPOL_F_NODE = 1 << 0;
+static constexpr const unsigned long NUMA_MPOL_F_ADDR = 1 << 1;
+
+//! The NUMA topology, read once from sysfs
+class NUMATopology {
+public:
+	NUMATopology() {
+		for (idx_t node = 0;; node++) {
+			string cpu_list;
+			if (!ReadFile("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", cpu_list)) {
+				break;
+			}
+			ParseCPUList(cpu_list, node);
+			node_count++;
+		}
+		if (node_count == 0) {
+			// no sysfs: treat the machine as a single node
+			node_count = 1;
+		}
+	}
+
+	idx_t GetNode(idx_t cpu) const {
+		return cpu < cpu_to_node.size() ? cpu_to_node[cpu] : 0;
+	}
+
+public:
+	idx_t node_count = 0;
+	vector<idx_t> cpu_to_node;
+	vector<vector<idx_t>> node_cpus;
+
+private:
+	static bool ReadFile(const string &path, string &result) {
+		auto fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		char buffer[4096];
+		auto bytes_read = read(fd, buffer, sizeof(buffer) - 1);
+		close(fd);
+		if (bytes_read <= 0) {
+			return false;
+		}
+		result = string(buffer, NumericCast<size_t>(bytes_read));
+		return true;
+	}
+
+	//! Parses a list of CPU ranges, e.g., "0-15,32-47"
+	void ParseCPUList(const string &cpu_list, idx_t node) {
+		node_cpus.emplace_back();
+		for (auto &range : StringUtil::Split(StringUtil::Replace(cpu_list, "\n", ""), ',')) {
+			auto bounds = StringUtil::Split(range, '-');
+			if (bounds.empty() || bounds.size() > 2) {
+				continue;
+			}
+			idx_t start = std::stoull(bounds[0]);
+			idx_t end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+			for (idx_t cpu = start; cpu <= end; cpu++) {
+				if (cpu >= cpu_to_node.size()) {
+					cpu_to_node.resize(cpu + 1, 0);
+				}
+				cpu_to_node[cpu] = node;
+				node_cpus[node].push_back(cpu);
+			}
+		}
+	}
+};
+
+static const NUMATopology &GetNUMATopology() {
+	static NUMATopology topology;
+	return topology;
+}
+
+idx_t NUMA::NodeCount() {
+	return GetNUMATopology().node_count;
+}
+
+idx_t NUMA::GetCurrentNode() {
+	auto &topology = GetNUMATopology();
+	if (topology.node_count == 1) {
+		return 0;
+	}
+	auto cpu = sched_getcpu();
+	if (cpu < 0) {
+		return 0;
+	}
+	return topology.GetNode(NumericCast<idx_t>(cpu));
+}
+
+idx_t NUMA::GetMemoryNode(const_data_ptr_t pointer) {
+	if (NodeCount() == 1) {
+		return 0;
+	}
+	int node = -1;
+	auto ret = syscall(__NR_get_mempolicy, &node, nullptr, 0, pointer, NUMA_MPOL_F_NODE | NUMA_MPOL_F_ADDR);
+	if (ret < 0 || node < 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	return NumericCast<idx_t>(node);
+}
+
+bool NUMA::PinThreadToNode(idx_t node) {
+	auto &topology = GetNUMATopology();
+	if (node >= topology.node_cpus.size()) {
+		return false;
+	}
+	// only use the CPUs of the node that the process is allowed to run on (e.g., in a container)
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+		return false;
+	}
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	bool any_cpu = false;
+	for (auto &cpu : topology.node_cpus[node]) {
+		if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+			CPU_SET(cpu, &cpus);
+			any_cpu = true;
+		}
+	}
+	if (!any_cpu) {
+		return false;
+	}
+	return sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+}
+
+#else
+
+idx_t NUMA::NodeCount() {
+	return 1;
+}
+
+idx_t NUMA::GetCurrentNode() {
+	return 0;
+}
+
+idx_t NUMA::GetMemoryNode(const_data_ptr_t pointer) {
+	return 0;
+}
+
+bool NUMA::PinThreadToNode(idx_t node) {
+	return false;
+}
+
+#endif
+
+} // namespace duckdb
@@ -17,6 +17,14 @@ void MergeSorter::PerformInMergeRound() {
 			}
 			GetNextPartition();
 		}
+		if (!state.external) {
+			// The boundaries of partitions of in-memory blocks are searched in parallel, so that all threads are busy
+			// merging, even in the last rounds of the cascaded merge where there are fewer pairs than threads
+			ComputePartitionBoundaries();
+			CreatePartitionSlices(false);
+			lock_guard<mutex> pair_guard(state.lock);
+			FinishPartitionSlices();
+		}
 		MergePartition();
 	}
 }
@@ -85,21 +93,60 @@ void MergeSorter::GetNextPartition() {
 	// Create result block
 	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
 	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	// Claim the next partition of the current pair
+	pair_idx = state.pair_idx;
+	partition_idx = state.partition_idx++;
+	if (state.partition_idx == state.pair_partitions[pair_idx]) {
+		// Advance pair
+		state.pair_idx++;
+		state.partition_idx = 0;
+	}
+	if (!state.external) {
+		return;
+	}
+	// Comparing blobs of blocks that are (partially) on disk swizzles and unswizzles pointers in place,
+	// so we compute the partition while holding the lock, continuing from the end of the previous partition
+	l_start = state.l_start;
+	r_start = state.r_start;
+	ComputePartitionBoundaries();
+	CreatePartitionSlices(true);
+	FinishPartitionSlices();
+	if (partition_idx + 1 == state.pair_partitions[pair_idx]) {
+		state.l_start = 0;
+		state.r_start = 0;
+	} else {
+		state.l_start = l_end;
+		state.r_start = r_end;
+	}
+}
+
+void MergeSorter::ComputePartitionBoundaries() {
 	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
+	auto &left_block = *state.sorted_blocks[pair_idx * 2];
+	auto &right_block = *state.sorted_blocks[pair_idx * 2 + 1];
 	const idx_t l_count = left_block.Count();
 	const idx_t r_count = right_block.Count();
 	// Initialize left and right reader
 	left = make_uniq<SBScanState>(buffer_manager, state);
 	right = make_uniq<SBScanState>(buffer_manager, state);
+	left->sb = &left_block;
+	right->sb = &right_block;
 	// Compute the work that this thread must do using Merge Path
-	idx_t l_end;
-	idx_t r_end;
-	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
-		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
+	if (state.external) {
+		// The start of the partition was set by the previous partition
+		D_ASSERT(l_start + r_start == partition_idx * state.block_capacity);
+	} else {
+		// Intersections must increase monotonically, there is no previous result to use yet
+		l_start = 0;
+		r_start = 0;
+		idx_t l_begin;
+		idx_t r_begin;
+		GetIntersection(partition_idx * state.block_capacity, l_begin, r_begin);
+		l_start = l_begin;
+		r_start = r_begin;
+	}
+	if (partition_idx + 1 < state.pair_partitions[pair_idx]) {
+		const idx_t intersection = (partition_idx + 1) * state.block_capacity;
 		GetIntersection(intersection, l_end, r_end);
 		D_ASSERT(l_end <= l_count);
 		D_ASSERT(r_end <= r_count);
@@ -108,25 +155,29 @@ void MergeSorter::GetNextPartition() {
 		l_end = l_count;
 		r_end = r_count;
 	}
+	D_ASSERT(l_start <= l_end && r_start <= r_end);
+}
+
+void MergeSorter::CreatePartitionSlices(bool reset_previous) {
+	auto &left_block = *state.sorted_blocks[pair_idx * 2];
+	auto &right_block = *state.sorted_blocks[pair_idx * 2 + 1];
 	// Create slices of the data that this thread must merge
 	left->SetIndices(0, 0);
 	right->SetIndices(0, 0);
-	left_input = left_block.CreateSlice(state.l_start, l_end, left->entry_idx);
-	right_input = right_block.CreateSlice(state.r_start, r_end, right->entry_idx);
+	left_input = left_block.CreateSlice(l_start, l_end, left->entry_idx, reset_previous);
+	right_input = right_block.CreateSlice(r_start, r_end, right->entry_idx, reset_previous);
 	left->sb = left_input.get();
 	right->sb = right_input.get();
-	state.l_start = l_end;
-	state.r_start = r_end;
-	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity || (l_end == l_count && r_end == r_count));
-	// Update global state
-	if (state.l_start == l_count && state.r_start == r_count) {
-		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
-		// Advance pair
-		state.pair_idx++;
-		state.l_start = 0;
-		state.r_start = 0;
+	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity ||
+	         (l_end == left_block.Count() && r_end == right_block.Count()));
+}
+
+void MergeSorter::FinishPartitionSlices() {
+	D_ASSERT(state.unsliced_partitions[pair_idx] > 0);
+	if (--state.unsliced_partitions[pair_idx] == 0) {
+		// Delete references to previous pair (the slices hold references to the blocks that are still needed)
+		state.sorted_blocks[pair_idx * 2] = nullptr;
+		state.sorted_blocks[pair_idx * 2 + 1] = nullptr;
 	}
 }
 
@@ -135,10 +186,10 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	D_ASSERT(r_idx < r.sb->Count());
 
 	// Easy comparison using the previous result (intersections must increase monotonically)
-	if (l_idx < state.l_start) {
+	if (l_idx < l_start) {
 		return -1;
 	}
-	if (r_idx < state.r_start) {
+	if (r_idx < r_start) {
 		return 1;
 	}
 
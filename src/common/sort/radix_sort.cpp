@@ -5,7 +5,54 @@
 
 namespace duckdb {
 
-//! Calls std::sort on strings that are tied by their prefix after the radix sort
+//! A string that is tied by its prefix, and the entry it belongs to
+struct TiedString {
+	string_t value;
+	data_ptr_t entry_ptr;
+};
+
+//! Compares the strings of two entries that are tied by their prefix - we skip the prefix, as it is known to be equal
+static inline int CompareTiedStrings(const string_t &left, const string_t &right, const idx_t prefix_length) {
+	const auto left_size = left.GetSize();
+	const auto right_size = right.GetSize();
+	const auto min_size = MinValue<idx_t>(left_size, right_size);
+	const auto skip = MinValue<idx_t>(prefix_length, min_size);
+	const auto memcmp_res = memcmp(left.GetData() + skip, right.GetData() + skip, min_size - skip);
+	if (memcmp_res != 0) {
+		return memcmp_res;
+	}
+	return left_size == right_size ? 0 : (left_size < right_size ? -1 : 1);
+}
+
+//! Sorts strings that are tied by their prefix after the radix sort. The strings are gathered into an array first, so
+//! the comparisons do not have to locate the blob row of every entry again.
+static void SortTiedStrings(data_ptr_t *entry_ptrs, const idx_t &count, const idx_t &tie_col, bool *ties,
+                            const data_ptr_t blob_ptr, const idx_t &tie_col_offset, const SortLayout &sort_layout) {
+	const auto row_width = sort_layout.blob_layout.GetRowWidth();
+	auto tied_strings = make_unsafe_uniq_array<TiedString>(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto blob_idx = Load<uint32_t>(entry_ptrs[i] + sort_layout.comparison_size);
+		tied_strings[i].value = Load<string_t>(blob_ptr + blob_idx * row_width + tie_col_offset);
+		tied_strings[i].entry_ptr = entry_ptrs[i];
+	}
+	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
+	const auto prefix_length = sort_layout.prefix_lengths[tie_col];
+	std::sort(tied_strings.get(), tied_strings.get() + count,
+	          [&order, &prefix_length](const TiedString &l, const TiedString &r) {
+		          return order * CompareTiedStrings(l.value, r.value, prefix_length) < 0;
+	          });
+	for (idx_t i = 0; i < count; i++) {
+		entry_ptrs[i] = tied_strings[i].entry_ptr;
+	}
+	// Determine if there are still ties (if this is not the last column)
+	if (tie_col < sort_layout.column_count - 1) {
+		for (idx_t i = 0; i < count - 1; i++) {
+			ties[i] = CompareTiedStrings(tied_strings[i].value, tied_strings[i + 1].value, prefix_length) == 0;
+		}
+	}
+}
+
+//! Calls std::sort on blobs that are tied by their prefix after the radix sort
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
 	const auto row_width = sort_layout.blob_layout.GetRowWidth();
@@ -23,20 +70,24 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		entry_ptrs[i - start] = row_ptr;
 		row_ptr += sort_layout.entry_size;
 	}
-	// Slow pointer-based sorting
-	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
-	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
-		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
-		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
-		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
-		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
-	          });
+	if (logical_type.InternalType() == PhysicalType::VARCHAR) {
+		SortTiedStrings(entry_ptrs, end - start, tie_col, ties + start, blob_ptr, tie_col_offset, sort_layout);
+	} else {
+		// Slow pointer-based sorting
+		const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
+		std::sort(entry_ptrs, entry_ptrs + end - start,
+		          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
+		                                                                                        const data_ptr_t r) {
+			          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
+			          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
+			          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
+			          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
+			          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          });
+	}
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
 	data_ptr_t temp_ptr = temp_block.get();
@@ -45,6 +96,10 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		temp_ptr += sort_layout.entry_size;
 	}
 	memcpy(dataptr + start * sort_layout.entry_size, temp_block.get(), (end - start) * sort_layout.entry_size);
+	if (logical_type.InternalType() == PhysicalType::VARCHAR) {
+		// the remaining ties have already been determined
+		return;
+	}
 	// Determine if there are still ties (if this is not the last column)
 	if (tie_col < sort_layout.column_count - 1) {
 		data_ptr_t idx_ptr = dataptr + start * sort_layout.entry_size + sort_layout.comparison_size;
@@ -72,13 +72,14 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			idx_t size_before = col_size;
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
+				if (col_size > SortConstants::MAX_INLINED_STRING_SIZE) {
+					col_size = SortConstants::STRING_PREFIX_SIZE;
 				} else {
+					// the strings are short enough to store them in full: we never have to break ties
 					constant_size.back() = true;
 				}
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_PREFIX_SIZE;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -442,12 +443,18 @@ void GlobalSortState::InitializeMergeRound() {
 	// Init merge path path indices
 	pair_idx = 0;
 	num_pairs = sorted_blocks.size() / 2;
+	partition_idx = 0;
+	pair_partitions.clear();
 	l_start = 0;
 	r_start = 0;
 	// Allocate room for merge results
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
 		sorted_blocks_temp.emplace_back();
+		// Every partition (except the last) produces a block of exactly block_capacity rows
+		const idx_t count = sorted_blocks[p_idx * 2]->Count() + sorted_blocks[p_idx * 2 + 1]->Count();
+		pair_partitions.push_back(count > block_capacity ? (count + block_capacity - 1) / block_capacity : 1);
 	}
+	unsliced_partitions = pair_partitions;
 }
 
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
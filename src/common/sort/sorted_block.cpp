@@ -35,7 +35,8 @@ void SortedData::CreateBlock() {
 	}
 }
 
-unique_ptr<SortedData> SortedData::CreateSlice(idx_t start_block_index, idx_t end_block_index, idx_t end_entry_index) {
+unique_ptr<SortedData> SortedData::CreateSlice(idx_t start_block_index, idx_t end_block_index, idx_t end_entry_index,
+                                               bool reset_previous) {
 	// Add the corresponding blocks to the result
 	auto result = make_uniq<SortedData>(type, layout, buffer_manager, state);
 	for (idx_t i = start_block_index; i <= end_block_index; i++) {
@@ -45,7 +46,7 @@ unique_ptr<SortedData> SortedData::CreateSlice(idx_t start_block_index, idx_t en
 		}
 	}
 	// All of the blocks that come before block with idx = start_block_idx can be reset (other references exist)
-	for (idx_t i = 0; i < start_block_index; i++) {
+	for (idx_t i = 0; reset_previous && i < start_block_index; i++) {
 		data_blocks[i]->block = nullptr;
 		if (!layout.AllConstant() && state.external) {
 			heap_blocks[i]->block = nullptr;
@@ -154,7 +155,8 @@ void SortedBlock::GlobalToLocalIndex(const idx_t &global_idx, idx_t &local_block
 	D_ASSERT(local_entry_index < radix_sorting_data[local_block_index]->count);
 }
 
-unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t end, idx_t &entry_idx) {
+unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t end, idx_t &entry_idx,
+                                                 bool reset_previous) {
 	// Identify blocks/entry indices of this slice
 	idx_t start_block_index;
 	idx_t start_entry_index;
@@ -168,7 +170,7 @@ unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t
 		result->radix_sorting_data.push_back(radix_sorting_data[i]->Copy());
 	}
 	// Reset all blocks that come before block with idx = start_block_idx (slice holds new reference)
-	for (idx_t i = 0; i < start_block_index; i++) {
+	for (idx_t i = 0; reset_previous && i < start_block_index; i++) {
 		radix_sorting_data[i]->block = nullptr;
 	}
 	// Use start and end entry indices to set the boundaries
@@ -177,10 +179,12 @@ unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t
 	result->radix_sorting_data.back()->count = end_entry_index;
 	// Same for the var size sorting data
 	if (!sort_layout.all_constant) {
-		result->blob_sorting_data = blob_sorting_data->CreateSlice(start_block_index, end_block_index, end_entry_index);
+		result->blob_sorting_data = blob_sorting_data->CreateSlice(start_block_index, end_block_index, end_entry_index,
+		                                                            reset_previous);
 	}
 	// And the payload data
-	result->payload_data = payload_data->CreateSlice(start_block_index, end_block_index, end_entry_index);
+	result->payload_data =
+	    payload_data->CreateSlice(start_block_index, end_block_index, end_entry_index, reset_previous);
 	return result;
 }
 
@@ -58,6 +58,10 @@ int64_t VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_byt
 	return handle.file_system.Read(handle, buffer, nr_bytes);
 }
 
+void VirtualFileSystem::BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) {
+	handle.file_system.BatchRead(handle, requests);
+}
+
 int64_t VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return handle.file_system.Write(handle, buffer, nr_bytes);
 }
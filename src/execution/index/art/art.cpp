@@ -1,5 +1,6 @@
 #include "duckdb/execution/index/art/art.hpp"
 
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -471,11 +472,7 @@ bool ConstructInternal(ART &art, vector<ARTKey> &keys, const row_t *row_ids, Nod
 	return true;
 }
 
-bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers) {
-
-	UnifiedVectorFormat row_id_data;
-	row_identifiers.ToUnifiedFormat(count, row_id_data);
-	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, const row_t *row_ids) {
 
 	auto key_section = KeySection(0, count - 1, 0, 0);
 	auto has_constraint = IsUnique();
@@ -495,6 +492,29 @@ bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_ide
 	return true;
 }
 
+bool ART::Construct(idx_t count, vector<ARTKey> &keys, vector<row_t> &row_ids) {
+
+	D_ASSERT(count > 0 && count <= keys.size() && count <= row_ids.size());
+	if (std::is_sorted(keys.begin(), keys.begin() + NumericCast<int64_t>(count))) {
+		return ConstructFromSorted(count, keys, row_ids.data());
+	}
+
+	// sort the positions of the keys, and then reorder the keys and row IDs
+	vector<idx_t> order(count);
+	for (idx_t i = 0; i < count; i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](const idx_t l, const idx_t r) { return keys[l] < keys[r]; });
+
+	vector<ARTKey> sorted_keys(count);
+	vector<row_t> sorted_row_ids(count);
+	for (idx_t i = 0; i < count; i++) {
+		sorted_keys[i] = keys[order[i]];
+		sorted_row_ids[i] = row_ids[order[i]];
+	}
+	return ConstructFromSorted(count, sorted_keys, sorted_row_ids.data());
+}
+
 //===--------------------------------------------------------------------===//
 // Insert / Verification / Constraint Checking
 //===--------------------------------------------------------------------===//
@@ -845,6 +865,84 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 	return nullptr;
 }
 
+static inline void PrefetchNode(const ART &art, const Node &node) {
+	// inlined leaves do not point to any memory
+	if (node.GetType() != NType::LEAF_INLINED) {
+		DUCKDB_PREFETCH_READ(Node::GetAllocator(art, node.GetType()).Get<const data_t>(node, false));
+	}
+}
+
+void ART::Lookup(const vector<ARTKey> &keys, const idx_t count, vector<Node> &leaves) {
+
+	D_ASSERT(keys.size() >= count);
+	leaves.resize(count);
+	for (idx_t i = 0; i < count; i++) {
+		leaves[i].Clear();
+	}
+	if (!tree.HasMetadata()) {
+		return;
+	}
+
+	// the current node and depth of each key that is still being traversed
+	vector<Node> nodes(count);
+	vector<idx_t> depths(count, 0);
+	vector<idx_t> active;
+	active.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		if (!keys[i].Empty()) {
+			nodes[i] = tree;
+			active.push_back(i);
+		}
+	}
+
+	// every round advances each active key by a single node, and prefetches the node it moves to.
+	// By the time we get back to a key, its node has (hopefully) arrived in the cache
+	while (!active.empty()) {
+		idx_t active_count = 0;
+		for (auto &i : active) {
+			auto &key = keys[i];
+			auto &node = nodes[i];
+			auto &depth = depths[i];
+
+			auto type = node.GetType();
+			if (type == NType::LEAF || type == NType::LEAF_INLINED) {
+				leaves[i] = node;
+				continue;
+			}
+
+			if (type == NType::PREFIX) {
+				auto &prefix = Node::Ref<const Prefix>(*this, node, NType::PREFIX);
+				idx_t prefix_idx = 0;
+				for (; prefix_idx < prefix.data[Node::PREFIX_SIZE]; prefix_idx++) {
+					if (prefix.data[prefix_idx] != key[depth]) {
+						break;
+					}
+					depth++;
+				}
+				if (prefix_idx != prefix.data[Node::PREFIX_SIZE]) {
+					// the prefix does not match the key
+					continue;
+				}
+				node = prefix.ptr;
+			} else {
+				D_ASSERT(depth < key.len);
+				auto child = node.GetChild(*this, key[depth]);
+				if (!child) {
+					// no child at byte, the ART does not contain the key
+					continue;
+				}
+				node = *child;
+				depth++;
+			}
+
+			D_ASSERT(node.HasMetadata());
+			PrefetchNode(*this, node);
+			active[active_count++] = i;
+		}
+		active.resize(active_count);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Greater Than and Less Than
 //===--------------------------------------------------------------------===//
@@ -1049,6 +1147,10 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	vector<ARTKey> keys(expression_chunk.size());
 	GenerateKeys<>(arena_allocator, expression_chunk, keys);
 
+	// look up all keys of the chunk at once
+	vector<Node> leaves;
+	Lookup(keys, input.size(), leaves);
+
 	idx_t found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 
@@ -1059,8 +1161,8 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 			continue;
 		}
 
-		auto leaf = Lookup(tree, keys[i], 0);
-		if (!leaf) {
+		auto &leaf = leaves[i];
+		if (!leaf.HasMetadata()) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
 			}
@@ -1069,8 +1171,8 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 
 		// when we find a node, we need to update the 'matches' and 'row_ids'
 		// NOTE: leaves can have more than one row_id, but for UNIQUE/PRIMARY KEY they will only have one
-		D_ASSERT(leaf->GetType() == NType::LEAF_INLINED);
-		if (conflict_manager.AddHit(i, leaf->GetRowId())) {
+		D_ASSERT(leaf.GetType() == NType::LEAF_INLINED);
+		if (conflict_manager.AddHit(i, leaf.GetRowId())) {
 			found_conflict = i;
 		}
 	}
@@ -54,6 +54,15 @@ void ARTKey::CreateARTKey(ArenaAllocator &allocator, const LogicalType &type, AR
 	ARTKey::CreateARTKey(allocator, type, key, string_t(value, UnsafeNumericCast<uint32_t>(strlen(value))));
 }
 
+bool ARTKey::operator<(const ARTKey &k) const {
+	auto min_len = MinValue<uint32_t>(len, k.len);
+	auto cmp = min_len == 0 ? 0 : memcmp(data, k.data, min_len);
+	if (cmp != 0) {
+		return cmp < 0;
+	}
+	return len < k.len;
+}
+
 bool ARTKey::operator>(const ARTKey &k) const {
 	for (uint32_t i = 0; i < MinValue<uint32_t>(len, k.len); i++) {
 		if (data[i] > k.data[i]) {
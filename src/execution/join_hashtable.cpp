@@ -1,6 +1,7 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -21,7 +22,8 @@ JoinHashTable::SharedState::SharedState()
 
 JoinHashTable::ProbeState::ProbeState()
     : SharedState(), salt_v(LogicalType::UBIGINT), ht_offsets_v(LogicalType::UBIGINT),
-      ht_offsets_dense_v(LogicalType::UBIGINT), non_empty_sel(STANDARD_VECTOR_SIZE) {
+      ht_offsets_dense_v(LogicalType::UBIGINT), non_empty_sel(STANDARD_VECTOR_SIZE),
+      bloom_filter_sel(STANDARD_VECTOR_SIZE) {
 }
 
 JoinHashTable::InsertState::InsertState(const unique_ptr<TupleDataCollection> &data_collection,
@@ -34,7 +36,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), use_bloom_filter(false), bloom_filter_rejected(0), track_heavy_hitters(false),
+      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 
 	for (idx_t i = 0; i < conditions.size(); ++i) {
 		auto &condition = conditions[i];
@@ -113,6 +116,7 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	{
 		lock_guard<mutex> guard(data_lock);
 		data_collection->Combine(*other.data_collection);
+		heavy_hitters.Combine(other.heavy_hitters);
 	}
 
 	if (join_type == JoinType::MARK) {
@@ -128,7 +132,8 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const idx_t &bitmask) {
+static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const idx_t &bitmask,
+                                        const atomic<ht_entry_t> entries[]) {
 
 	if (hashes_v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 
@@ -144,9 +149,12 @@ static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, co
 		hashes_v.Flatten(count);
 		auto hashes = FlatVector::GetData<hash_t>(hashes_v);
 
+		// the entries of a chunk are spread over the entire pointer table: issue all their cache misses at once here,
+		// so that the (dependent) linear probing loop of the insert does not stall on every row
 		for (idx_t i = 0; i < count; i++) {
 			idx_t salt = ht_entry_t::ExtractSaltWithNulls(hashes[i]);
 			idx_t offset = hashes[i] & bitmask;
+			DUCKDB_PREFETCH_WRITE(entries + offset);
 			hashes[i] = offset | salt;
 		}
 	}
@@ -165,7 +173,8 @@ template <bool USE_SALTS>
 static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &key_state,
                                           JoinHashTable::ProbeState &state, Vector &hashes_v,
                                           const SelectionVector &sel, idx_t &count, JoinHashTable *ht,
-                                          ht_entry_t *entries, Vector &pointers_result_v, SelectionVector &match_sel) {
+                                          ht_entry_t *entries, optional_ptr<const JoinBloomFilter> bloom_filter,
+                                          Vector &pointers_result_v, SelectionVector &match_sel) {
 
 	UnifiedVectorFormat hashes_v_unified;
 	hashes_v.ToUnifiedFormat(count, hashes_v_unified);
@@ -178,11 +187,22 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 
 	idx_t non_empty_count = 0;
 
+	// if we have a Bloom filter, reject the rows that cannot have a match before touching the pointer table
+	const SelectionVector *probe_sel = &sel;
+	if (bloom_filter) {
+		const auto bloom_match_count = bloom_filter->Filter(hashes_v_unified, sel, count, state.bloom_filter_sel);
+		ht->bloom_filter_rejected.fetch_add(count - bloom_match_count, std::memory_order_relaxed);
+		probe_sel = &state.bloom_filter_sel;
+		count = bloom_match_count;
+	}
+
 	// first, filter out the empty rows and calculate the offset
+	// the entries are prefetched here, so the cache misses of the whole chunk are in flight by the time we read them
 	for (idx_t i = 0; i < count; i++) {
-		const auto row_index = sel.get_index(i);
+		const auto row_index = probe_sel->get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
 		auto ht_offset = hashes[uvf_index] & ht->bitmask;
+		DUCKDB_PREFETCH_READ(entries + ht_offset);
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
 	}
@@ -200,7 +220,7 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	for (idx_t i = 0; i < non_empty_count; i++) {
 		// transform the dense index to the actual index in the sel vector
 		idx_t dense_index = state.non_empty_sel.get_index(i);
-		const auto row_index = sel.get_index(dense_index);
+		const auto row_index = probe_sel->get_index(dense_index);
 		state.non_empty_sel.set_index(i, row_index);
 
 		if (USE_SALTS) {
@@ -263,6 +283,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+			if (occupied) {
+				// the keys of the row are compared below, fetch them while we probe the other rows
+				DUCKDB_PREFETCH_READ(row_ptr_insert_to[row_index]);
+			}
 		}
 
 		if (salt_match_count != 0) {
@@ -306,12 +330,16 @@ void JoinHashTable::GetRowPointers(DataChunk &keys, TupleDataChunkState &key_sta
                                    const SelectionVector &sel, idx_t &count, Vector &pointers_result_v,
                                    SelectionVector &match_sel) {
 
+	optional_ptr<const JoinBloomFilter> bloom_filter_ptr;
+	if (bloom_filter.IsInitialized()) {
+		bloom_filter_ptr = &bloom_filter;
+	}
 	if (UseSalt()) {
-		GetRowPointersInternal<true>(keys, key_state, state, hashes_v, sel, count, this, entries, pointers_result_v,
-		                             match_sel);
+		GetRowPointersInternal<true>(keys, key_state, state, hashes_v, sel, count, this, entries, bloom_filter_ptr,
+		                             pointers_result_v, match_sel);
 	} else {
-		GetRowPointersInternal<false>(keys, key_state, state, hashes_v, sel, count, this, entries, pointers_result_v,
-		                              match_sel);
+		GetRowPointersInternal<false>(keys, key_state, state, hashes_v, sel, count, this, entries, bloom_filter_ptr,
+		                              pointers_result_v, match_sel);
 	}
 }
 
@@ -414,6 +442,9 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
 	hash_values.ToUnifiedFormat(source_chunk.size(), append_state.chunk_state.vector_data.back().unified);
+	if (track_heavy_hitters) {
+		heavy_hitters.Update(append_state.chunk_state.vector_data.back().unified, *current_sel, added_count);
+	}
 
 	// We already called TupleDataCollection::ToUnifiedFormat, so we can AppendUnified here
 	sink_collection->AppendUnified(append_state, source_chunk, *current_sel, added_count);
@@ -560,7 +591,7 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector row_locations,
                              JoinHashTable::InsertState &state, unique_ptr<TupleDataCollection> &data_collection,
                              JoinHashTable *ht) {
 	D_ASSERT(hashes_v.GetType().id() == LogicalType::HASH);
-	ApplyBitmaskAndGetSaltBuild(hashes_v, count, ht->bitmask);
+	ApplyBitmaskAndGetSaltBuild(hashes_v, count, ht->bitmask, entries);
 
 	// the offset for each row to insert
 	idx_t *ht_offsets_and_salts = FlatVector::GetData<idx_t>(hashes_v);
@@ -693,6 +724,13 @@ void JoinHashTable::InitializePointerTable() {
 	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
 
 	bitmask = capacity - 1;
+
+	// allocate an empty Bloom filter, it is filled while inserting the hashes in Finalize
+	if (use_bloom_filter && Count() >= BLOOM_FILTER_THRESHOLD) {
+		bloom_filter.Initialize(buffer_manager.GetBufferAllocator(), Count());
+	} else {
+		bloom_filter.Reset();
+	}
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -712,6 +750,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter.IsInitialized()) {
+			// this has to happen before inserting, as InsertHashes overwrites the hashes with the offsets and salts
+			bloom_filter.Insert(hash_data, count, parallel);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
@@ -1371,13 +1413,58 @@ void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &l
                                             const idx_t max_partition_size, const idx_t max_partition_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
 
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	vector<idx_t> partition_sizes(num_partitions, 0);
+	vector<idx_t> partition_counts(num_partitions, 0);
+	JoinHeavyHitters global_heavy_hitters;
+	for (auto &ht : local_hts) {
+		ht->GetSinkCollection().GetSizesAndCounts(partition_sizes, partition_counts);
+		global_heavy_hitters.Combine(ht->heavy_hitters);
+	}
+
+	// All rows of a key end up in the same partition, no matter how many bits we add. If the build side is skewed,
+	// adding bits does not make the partitions of the heavy hitters fit: these are built on their own anyway (see
+	// PrepareExternalFinalize). We only add enough bits for the remaining rows of the partitions to fit.
+	// Note that this does not solve the case where the rows of a heavy hitter exceed max_ht_size by themselves: there
+	// is no strategy for that, the partition is still built as a single hash table, which may exceed the memory limit.
+	idx_t total_count = 0;
+	for (auto &count : partition_counts) {
+		total_count += count;
+	}
+	// the sketch is only guaranteed to find hashes that make up more than 1 / CAPACITY of the (sampled) build side,
+	// any counter below that may just be noise
+	const auto min_heavy_count = MaxValue<idx_t>(total_count / JoinHeavyHitters::CAPACITY, 1);
+	const auto mask = RadixPartitioning::Mask(radix_bits);
+	vector<idx_t> heavy_counts(num_partitions, 0);
+	for (auto &heavy_hitter : global_heavy_hitters.GetHeavyHitters(min_heavy_count)) {
+		const auto partition_idx = (heavy_hitter.hash & mask) >> RadixPartitioning::Shift(radix_bits);
+		heavy_counts[partition_idx] += heavy_hitter.count;
+	}
+	idx_t max_splittable_size = 0;
+	idx_t max_splittable_count = 0;
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		const auto count = partition_counts[partition_idx];
+		if (count == 0) {
+			continue;
+		}
+		const auto splittable_count = count - MinValue(heavy_counts[partition_idx], count);
+		const auto splittable_size = NumericCast<idx_t>(static_cast<double>(partition_sizes[partition_idx]) *
+		                                                static_cast<double>(splittable_count) /
+		                                                static_cast<double>(count));
+		if (splittable_size + PointerTableSize(splittable_count) >
+		    max_splittable_size + PointerTableSize(max_splittable_count)) {
+			max_splittable_size = splittable_size;
+			max_splittable_count = splittable_count;
+		}
+	}
+
 	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
 	idx_t added_bits = 1;
 	for (; added_bits < max_added_bits; added_bits++) {
 		double partition_multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
 
-		auto new_estimated_size = double(max_partition_size) / partition_multiplier;
-		auto new_estimated_count = double(max_partition_count) / partition_multiplier;
+		auto new_estimated_size = double(max_splittable_size) / partition_multiplier;
+		auto new_estimated_count = double(max_splittable_count) / partition_multiplier;
 		auto new_estimated_ht_size =
 		    new_estimated_size + static_cast<double>(PointerTableSize(NumericCast<idx_t>(new_estimated_count)));
 
@@ -915,6 +915,28 @@ string PhysicalHashAggregate::ParamsToString() const {
 			result += " Filter: " + aggregate.filter->GetName();
 		}
 	}
+	if (sink_state) {
+		// statistics of the out-of-core aggregation so far
+		auto &sink = sink_state->Cast<HashAggregateGlobalSinkState>();
+		RadixHTStatistics statistics;
+		for (auto &grouping_state : sink.grouping_states) {
+			RadixPartitionedHashTable::GetStatistics(*grouping_state.table_state, statistics);
+		}
+		string statistics_info;
+		if (statistics.spill_size != 0) {
+			statistics_info += "Spill Size: " + StringUtil::BytesToHumanReadableString(statistics.spill_size) + "\n";
+			statistics_info += StringUtil::Format("Partitions: %llu\n", statistics.partition_count);
+			statistics_info += StringUtil::Format("Finalize Repartitions: %llu\n", statistics.finalize_repartitions);
+			statistics_info += StringUtil::Format("Finalize Waits: %llu\n", statistics.finalize_waits);
+		}
+		if (statistics.skipped_lookups != 0) {
+			statistics_info += StringUtil::Format("Skipped Lookups: %llu\n", statistics.skipped_lookups);
+		}
+		if (!statistics_info.empty()) {
+			statistics_info.pop_back();
+			result += "\n\n[INFOSEPARATOR]\n" + statistics_info;
+		}
+	}
 	return result;
 }
 
@@ -0,0 +1,370 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+#ifdef DEBUG
+	for (auto &group : groups) {
+		D_ASSERT(group->GetExpressionClass() == ExpressionClass::BOUND_REF);
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.IsDistinct() && !aggr.filter);
+	}
+#endif
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &client, const PhysicalStreamingAggregate &op);
+	~StreamingAggregateState() override;
+
+public:
+	//! Finds the groups of the input, returns the number of groups that are complete after processing it
+	idx_t ComputeGroups(DataChunk &input);
+	//! Updates the aggregate states of the groups with the input
+	void Update(DataChunk &input);
+	//! Finalizes the complete groups into the output, and moves the state of the last group to the first slot
+	void Finalize(DataChunk &input, idx_t complete_count);
+	//! Finalizes the last group into the output
+	void FinalizeLastGroup();
+	bool HasGroup() const {
+		return has_group;
+	}
+
+private:
+	data_ptr_t GetState(idx_t slot) {
+		return state_data.get() + slot * state_width;
+	}
+	//! Sets the state pointers of the given slots, for the aggregate with the given index
+	void SetStatePointers(idx_t aggr_idx, idx_t slot_offset, idx_t count);
+	void InitializeStates(idx_t slot_offset, idx_t count);
+	void FinalizeStates(idx_t slot_offset, idx_t count);
+	//! Moves the state of the open group (in slot 0) to the spare arena, and resets the arena
+	void CompactArena();
+
+public:
+	const PhysicalStreamingAggregate &op;
+	//! The arena of the aggregate states. Once the complete groups have been finalized and destroyed, only the state
+	//! of the open group references it: when it has grown, the open group is moved to the spare arena and the arena is
+	//! reset, so that the memory usage does not grow with the input
+	unique_ptr<ArenaAllocator> allocator;
+	unique_ptr<ArenaAllocator> spare_allocator;
+	//! The size of the arena after it was last compacted
+	idx_t compacted_size;
+	//! Buffered output
+	DataChunk output;
+
+private:
+	//! The aggregate states of the groups of the current input: the group that was started in a previous input is in
+	//! slot 0, followed by the groups that are started in the current input
+	unsafe_unique_array<data_t> state_data;
+	idx_t state_width;
+	vector<idx_t> state_offsets;
+	//! Whether or not there is a group in slot 0, and its values
+	bool has_group;
+	vector<Value> group_values;
+
+	//! The group (slot) of every input row, and the rows at which the groups of the current input start
+	Vector state_pointers;
+	unsafe_unique_array<idx_t> row_slots;
+	SelectionVector group_starts;
+	SelectionVector distinct_sel;
+	//! The slot of the first group that starts in the current input, and the number of groups in the input
+	idx_t first_slot;
+	idx_t slot_count;
+	//! The inputs of the aggregates
+	DataChunk payload;
+};
+
+StreamingAggregateState::StreamingAggregateState(ClientContext &client, const PhysicalStreamingAggregate &op)
+    : op(op), allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(client))),
+      spare_allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(client))), compacted_size(0), has_group(false),
+      state_pointers(LogicalType::POINTER), group_starts(STANDARD_VECTOR_SIZE), distinct_sel(STANDARD_VECTOR_SIZE),
+      first_slot(0), slot_count(0) {
+	output.Initialize(client, op.types);
+
+	state_width = 0;
+	vector<LogicalType> payload_types;
+	for (auto &aggregate : op.aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		state_offsets.push_back(state_width);
+		state_width += AlignValue(aggr.function.state_size());
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+		}
+	}
+	// every input row can start a new group, plus one slot for the group of a previous input
+	state_data = make_unsafe_uniq_array<data_t>((STANDARD_VECTOR_SIZE + 1) * MaxValue<idx_t>(state_width, 1));
+	row_slots = make_unsafe_uniq_array<idx_t>(STANDARD_VECTOR_SIZE);
+	payload.InitializeEmpty(payload_types);
+}
+
+StreamingAggregateState::~StreamingAggregateState() {
+	if (has_group) {
+		// destroy the state of the group that was never finalized (e.g. because of a LIMIT)
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+			if (!aggr.function.destructor) {
+				continue;
+			}
+			SetStatePointers(aggr_idx, 0, 1);
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), *allocator);
+			aggr.function.destructor(state_pointers, aggr_input_data, 1);
+		}
+	}
+}
+
+void StreamingAggregateState::SetStatePointers(idx_t aggr_idx, idx_t slot_offset, idx_t count) {
+	auto pointers = FlatVector::GetData<data_ptr_t>(state_pointers);
+	for (idx_t i = 0; i < count; i++) {
+		pointers[i] = GetState(slot_offset + i) + state_offsets[aggr_idx];
+	}
+}
+
+void StreamingAggregateState::InitializeStates(idx_t slot_offset, idx_t count) {
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (idx_t i = 0; i < count; i++) {
+			aggr.function.initialize(GetState(slot_offset + i) + state_offsets[aggr_idx]);
+		}
+	}
+}
+
+void StreamingAggregateState::FinalizeStates(idx_t slot_offset, idx_t count) {
+	const auto output_offset = output.size();
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		SetStatePointers(aggr_idx, slot_offset, count);
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), *allocator);
+		auto &result = output.data[op.groups.size() + aggr_idx];
+		aggr.function.finalize(state_pointers, aggr_input_data, result, count, output_offset);
+		if (aggr.function.destructor) {
+			aggr.function.destructor(state_pointers, aggr_input_data, count);
+		}
+	}
+}
+
+void StreamingAggregateState::CompactArena() {
+	// slot 1 is unused after the complete groups have been finalized: create a copy of the open group there
+	InitializeStates(1, 1);
+	Vector source_pointer(LogicalType::POINTER);
+	Vector target_pointer(LogicalType::POINTER);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		FlatVector::GetData<data_ptr_t>(source_pointer)[0] = GetState(0) + state_offsets[aggr_idx];
+		FlatVector::GetData<data_ptr_t>(target_pointer)[0] = GetState(1) + state_offsets[aggr_idx];
+		// PRESERVE_INPUT: the copy does not reference the memory of the original state
+		AggregateInputData combine_input_data(aggr.bind_info.get(), *spare_allocator);
+		aggr.function.combine(source_pointer, target_pointer, combine_input_data, 1);
+		if (aggr.function.destructor) {
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), *allocator);
+			aggr.function.destructor(source_pointer, aggr_input_data, 1);
+		}
+	}
+	memcpy(GetState(0), GetState(1), state_width);
+	allocator->Reset();
+	std::swap(allocator, spare_allocator);
+	compacted_size = allocator->SizeInBytes();
+}
+
+idx_t StreamingAggregateState::ComputeGroups(DataChunk &input) {
+	const auto count = input.size();
+	D_ASSERT(count > 0);
+
+	// a new group starts at every row where one of the group values differs from the previous row
+	auto is_start = row_slots.get();
+	std::fill_n(is_start, count, 0);
+	for (idx_t group_idx = 0; count > 1 && group_idx < op.groups.size(); group_idx++) {
+		auto &group_vector = input.data[op.groups[group_idx]->Cast<BoundReferenceExpression>().index];
+		Vector previous(group_vector, 0, count - 1);
+		Vector current(group_vector, 1, count);
+		const auto distinct_count =
+		    VectorOperations::DistinctFrom(current, previous, nullptr, count - 1, &distinct_sel, nullptr);
+		for (idx_t i = 0; i < distinct_count; i++) {
+			is_start[distinct_sel.get_index(i) + 1] = 1;
+		}
+	}
+
+	// the first row starts a new group, unless it continues the group of the previous input
+	bool continues_group = has_group;
+	for (idx_t group_idx = 0; continues_group && group_idx < op.groups.size(); group_idx++) {
+		auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+		continues_group = Value::NotDistinctFrom(input.GetValue(group.index, 0), group_values[group_idx]);
+	}
+	is_start[0] = !continues_group;
+
+	// assign a slot to every row
+	first_slot = has_group ? 1 : 0;
+	idx_t start_count = 0;
+	idx_t slot = continues_group ? 0 : first_slot - 1;
+	for (idx_t i = 0; i < count; i++) {
+		if (is_start[i]) {
+			group_starts.set_index(start_count++, i);
+			slot++;
+		}
+		row_slots[i] = slot;
+	}
+	slot_count = first_slot + start_count;
+	// all groups except for the last one are complete
+	return slot_count - 1;
+}
+
+void StreamingAggregateState::Update(DataChunk &input) {
+	InitializeStates(first_slot, slot_count - first_slot);
+
+	idx_t payload_idx = 0;
+	for (auto &aggregate : op.aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		for (auto &child : aggr.children) {
+			payload.data[payload_idx++].Reference(input.data[child->Cast<BoundReferenceExpression>().index]);
+		}
+	}
+	payload.SetCardinality(input);
+
+	payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto child_count = aggr.children.size();
+		auto inputs = child_count == 0 ? nullptr : &payload.data[payload_idx];
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), *allocator);
+		if (row_slots[0] == row_slots[input.size() - 1] && aggr.function.simple_update) {
+			// all rows belong to the same group
+			auto state = GetState(row_slots[0]) + state_offsets[aggr_idx];
+			aggr.function.simple_update(inputs, aggr_input_data, child_count, state, input.size());
+		} else {
+			auto pointers = FlatVector::GetData<data_ptr_t>(state_pointers);
+			for (idx_t i = 0; i < input.size(); i++) {
+				pointers[i] = GetState(row_slots[i]) + state_offsets[aggr_idx];
+			}
+			aggr.function.update(inputs, aggr_input_data, child_count, state_pointers, input.size());
+		}
+		payload_idx += child_count;
+	}
+}
+
+void StreamingAggregateState::Finalize(DataChunk &input, idx_t complete_count) {
+	const auto output_offset = output.size();
+	D_ASSERT(output_offset + complete_count <= STANDARD_VECTOR_SIZE);
+	if (complete_count > 0) {
+		// the group values of the complete groups: the group of the previous input, followed by the rows at which the
+		// complete groups of this input start
+		idx_t start_offset = 0;
+		if (first_slot == 1) {
+			for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+				output.data[group_idx].SetValue(output_offset, group_values[group_idx]);
+			}
+			start_offset = 1;
+		}
+		const auto input_complete_count = complete_count - start_offset;
+		for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+			auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+			VectorOperations::Copy(input.data[group.index], output.data[group_idx], group_starts,
+			                       input_complete_count, 0, output_offset + start_offset);
+		}
+		FinalizeStates(0, complete_count);
+		output.SetCardinality(output_offset + complete_count);
+
+		// move the state of the last (incomplete) group to the first slot
+		memcpy(GetState(0), GetState(complete_count), state_width);
+		// compact the arena when it has doubled in size, so that it is copied an amortized constant number of times
+		if (allocator->SizeInBytes() > MaxValue<idx_t>(Storage::BLOCK_SIZE, 2 * compacted_size)) {
+			CompactArena();
+		}
+	}
+
+	// remember the values of the last group, we need them to check whether the next input continues this group
+	has_group = true;
+	group_values.clear();
+	for (auto &group : op.groups) {
+		group_values.push_back(input.GetValue(group->Cast<BoundReferenceExpression>().index, input.size() - 1));
+	}
+}
+
+void StreamingAggregateState::FinalizeLastGroup() {
+	D_ASSERT(has_group && output.size() < STANDARD_VECTOR_SIZE);
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		output.data[group_idx].SetValue(output.size(), group_values[group_idx]);
+	}
+	FinalizeStates(0, 1);
+	output.SetCardinality(output.size() + 1);
+	has_group = false;
+}
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (input.size() == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	idx_t complete_count = state.ComputeGroups(input);
+	if (state.output.size() + complete_count > STANDARD_VECTOR_SIZE) {
+		// the complete groups do not fit in the output anymore: emit the output first
+		chunk.Move(state.output);
+		state.output.Initialize(context.client, types);
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+
+	state.Update(input);
+	state.Finalize(input, complete_count);
+	if (state.output.size() == STANDARD_VECTOR_SIZE) {
+		chunk.Move(state.output);
+		state.output.Initialize(context.client, types);
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (state.HasGroup()) {
+		if (state.output.size() == STANDARD_VECTOR_SIZE) {
+			chunk.Move(state.output);
+			state.output.Initialize(context.client, types);
+			return OperatorFinalizeResultType::HAVE_MORE_OUTPUT;
+		}
+		state.FinalizeLastGroup();
+	}
+	chunk.Move(state.output);
+	state.output.Initialize(context.client, types);
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+	}
+	return result;
+}
+
+} // namespace duckdb
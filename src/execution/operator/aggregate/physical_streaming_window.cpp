@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
@@ -207,6 +208,172 @@ public:
 		Vector temp;
 	};
 
+	//! An aggregate over a bounded ROWS frame (from n PRECEDING or UNBOUNDED PRECEDING to m PRECEDING or CURRENT ROW).
+	//! The frame is a queue of rows: every row has its own aggregate state, which is kept until the row leaves the
+	//! frame. Rows enter the frame at the back, where they are combined into a single state. When a row leaves the
+	//! frame and there are no front states, the states of the back rows are turned into suffix states (i.e. the state
+	//! of a row covers all later rows of the frame). The frame is then the first front state combined with the back
+	//! state, so every row is combined a constant number of times, and no inverse of the aggregate is needed.
+	struct FrameAggregateState {
+		//! The largest supported frame offset, which bounds the number of buffered states
+		static constexpr idx_t MAX_OFFSET = STANDARD_VECTOR_SIZE;
+
+		static bool ComputeOffset(ClientContext &context, WindowBoundary boundary, Expression *expr, idx_t &offset) {
+			switch (boundary) {
+			case WindowBoundary::CURRENT_ROW_ROWS:
+				offset = 0;
+				return true;
+			case WindowBoundary::EXPR_PRECEDING_ROWS: {
+				if (!expr || expr->HasParameter() || !expr->IsFoldable()) {
+					return false;
+				}
+				auto offset_value = ExpressionExecutor::EvaluateScalar(context, *expr);
+				Value bigint_value;
+				if (offset_value.IsNull() ||
+				    !offset_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+					return false;
+				}
+				const auto value = bigint_value.GetValue<int64_t>();
+				// negative offsets are an error, which is reported by PhysicalWindow
+				if (value < 0 || idx_t(value) >= MAX_OFFSET) {
+					return false;
+				}
+				offset = idx_t(value);
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+		static bool ComputeBounds(ClientContext &context, BoundWindowExpression &wexpr, bool &unbounded,
+		                          idx_t &start_offset, idx_t &end_offset) {
+			unbounded = wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING;
+			start_offset = 0;
+			if (!unbounded && !ComputeOffset(context, wexpr.start, wexpr.start_expr.get(), start_offset)) {
+				return false;
+			}
+			if (!ComputeOffset(context, wexpr.end, wexpr.end_expr.get(), end_offset)) {
+				return false;
+			}
+			return unbounded || end_offset <= start_offset;
+		}
+
+		FrameAggregateState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator)
+		    : wexpr(wexpr), aggregate(*wexpr.aggregate), arena_allocator(Allocator::DefaultAllocator()),
+		      executor(client), filter_executor(client), source_v(LogicalType::POINTER, data_ptr_cast(&source_ptr)),
+		      target_v(LogicalType::POINTER, data_ptr_cast(&target_ptr)), row_count(0), frame_begin(0), front_end(0),
+		      frame_end(0) {
+			D_ASSERT(wexpr.GetExpressionType() == ExpressionType::WINDOW_AGGREGATE);
+			ComputeBounds(client, wexpr, unbounded, start_offset, end_offset);
+			// rows are buffered until they enter the frame, and (if the frame is bounded) until they leave it
+			capacity = (unbounded ? end_offset : start_offset) + 1;
+			state_size = AlignValue(aggregate.state_size());
+			states = make_unsafe_uniq_array<data_t>(capacity * state_size);
+			back_state = make_unsafe_uniq_array<data_t>(state_size);
+			temp_state = make_unsafe_uniq_array<data_t>(state_size);
+			aggregate.initialize(back_state.get());
+
+			for (auto &child : wexpr.children) {
+				arg_types.push_back(child->return_type);
+				executor.AddExpression(*child);
+			}
+			if (!arg_types.empty()) {
+				arg_chunk.Initialize(allocator, arg_types);
+				arg_cursor.Initialize(allocator, arg_types);
+			}
+			if (wexpr.filter_expr) {
+				filter_executor.AddExpression(*wexpr.filter_expr);
+				filter_sel.Initialize();
+			}
+		}
+
+		~FrameAggregateState() {
+			DestroyStates();
+		}
+
+		void Execute(ExecutionContext &context, DataChunk &input, const bool *partition_starts, Vector &result);
+
+		data_ptr_t GetState(idx_t row) {
+			return states.get() + (row % capacity) * state_size;
+		}
+
+		void Combine(data_ptr_t source, data_ptr_t target, AggregateInputData &aggr_input_data) {
+			source_ptr = source;
+			target_ptr = target;
+			aggregate.combine(source_v, target_v, aggr_input_data, 1);
+		}
+
+		void Destroy(data_ptr_t state) {
+			if (aggregate.destructor) {
+				AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+				target_ptr = state;
+				aggregate.destructor(target_v, aggr_input_data, 1);
+			}
+		}
+
+		//! Destroys the states of the buffered rows and the back state
+		void DestroyStates() {
+			const auto first_buffered = unbounded ? frame_end : frame_begin;
+			for (idx_t row = first_buffered; row < row_count; row++) {
+				Destroy(GetState(row));
+			}
+			Destroy(back_state.get());
+		}
+
+		//! Starts a new partition
+		void Reset() {
+			DestroyStates();
+			arena_allocator.Reset();
+			aggregate.initialize(back_state.get());
+			row_count = 0;
+			frame_begin = 0;
+			front_end = 0;
+			frame_end = 0;
+		}
+
+		//! The aggregate expression
+		BoundWindowExpression &wexpr;
+		AggregateFunction &aggregate;
+		//! The allocator to use for aggregate data structures
+		ArenaAllocator arena_allocator;
+		//! Reusable executor for the children
+		ExpressionExecutor executor;
+		//! Shared executor for FILTER clauses
+		ExpressionExecutor filter_executor;
+		//! The frame offsets
+		bool unbounded;
+		idx_t start_offset;
+		idx_t end_offset;
+		//! The ring buffer with the states of the buffered rows, and the size of a state
+		idx_t capacity;
+		idx_t state_size;
+		unsafe_unique_array<data_t> states;
+		//! The state of the rows at the back of the frame, and a state to combine the front and back state in
+		unsafe_unique_array<data_t> back_state;
+		unsafe_unique_array<data_t> temp_state;
+		//! Single state vectors for combining and finalizing states
+		data_ptr_t source_ptr = nullptr;
+		data_ptr_t target_ptr = nullptr;
+		Vector source_v;
+		Vector target_v;
+		//! The number of rows of the current partition
+		idx_t row_count;
+		//! The rows [frame_begin, front_end) have front (suffix) states, the rows [front_end, frame_end) are in the
+		//! back state, and the rows [frame_end, row_count) have not entered the frame yet
+		idx_t frame_begin;
+		idx_t front_end;
+		idx_t frame_end;
+		//! The inputs rows that pass the FILTER
+		SelectionVector filter_sel;
+		//! Argument types
+		vector<LogicalType> arg_types;
+		//! Argument value buffer
+		DataChunk arg_chunk;
+		//! Argument cursor (a one element slice of arg_chunk)
+		DataChunk arg_cursor;
+	};
+
 	explicit StreamingWindowState(ClientContext &client) : initialized(false), allocator(Allocator::Get(client)) {
 	}
 
@@ -216,14 +383,35 @@ public:
 	void Initialize(ClientContext &context, DataChunk &input, const vector<unique_ptr<Expression>> &expressions) {
 		const_vectors.resize(expressions.size());
 		aggregate_states.resize(expressions.size());
+		frame_states.resize(expressions.size());
 		lead_lag_states.resize(expressions.size());
 
+		// All expressions share the partitions of the first one
+		auto &first_expr = expressions[0]->Cast<BoundWindowExpression>();
+		if (!first_expr.partitions.empty()) {
+			vector<LogicalType> partition_types;
+			partition_executor = make_uniq<ExpressionExecutor>(context);
+			for (auto &partition : first_expr.partitions) {
+				partition_types.push_back(partition->return_type);
+				partition_executor->AddExpression(*partition);
+			}
+			partition_chunk.Initialize(allocator, partition_types);
+			partition_starts = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+			distinct_sel.Initialize();
+		}
+
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
 			switch (expr.GetExpressionType()) {
 			case ExpressionType::WINDOW_AGGREGATE:
-				aggregate_states[expr_idx] = make_uniq<AggregateState>(context, wexpr, allocator);
+				if (wexpr.partitions.empty() && wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING &&
+				    wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+					// Running aggregate over the entire input
+					aggregate_states[expr_idx] = make_uniq<AggregateState>(context, wexpr, allocator);
+				} else {
+					frame_states[expr_idx] = make_uniq<FrameAggregateState>(context, wexpr, allocator);
+				}
 				break;
 			case ExpressionType::WINDOW_FIRST_VALUE: {
 				// Just execute the expression once
@@ -256,14 +444,56 @@ public:
 		initialized = true;
 	}
 
+	void ComputePartitionStarts(DataChunk &input) {
+		const auto count = input.size();
+		partition_chunk.Reset();
+		partition_executor->Execute(input, partition_chunk);
+
+		// A new partition starts at every row where one of the partition values differs from the previous row
+		std::fill_n(partition_starts.get(), count, false);
+		for (idx_t col_idx = 0; count > 1 && col_idx < partition_chunk.ColumnCount(); col_idx++) {
+			auto &partition_vector = partition_chunk.data[col_idx];
+			Vector previous(partition_vector, 0, count - 1);
+			Vector current(partition_vector, 1, count);
+			const auto distinct_count =
+			    VectorOperations::DistinctFrom(current, previous, nullptr, count - 1, &distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				partition_starts[distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+
+		// The first row starts a new partition, unless it continues the partition of the previous input
+		bool continues_partition = !partition_values.empty();
+		for (idx_t col_idx = 0; continues_partition && col_idx < partition_chunk.ColumnCount(); col_idx++) {
+			continues_partition =
+			    Value::NotDistinctFrom(partition_chunk.GetValue(col_idx, 0), partition_values[col_idx]);
+		}
+		partition_starts[0] = !continues_partition;
+
+		partition_values.clear();
+		for (idx_t col_idx = 0; col_idx < partition_chunk.ColumnCount(); col_idx++) {
+			partition_values.push_back(partition_chunk.GetValue(col_idx, count - 1));
+		}
+	}
+
 public:
 	bool initialized;
 	vector<unique_ptr<Vector>> const_vectors;
 
 	// Aggregation
 	vector<unique_ptr<AggregateState>> aggregate_states;
+	vector<unique_ptr<FrameAggregateState>> frame_states;
 	Allocator &allocator;
 
+	//	Partitions
+	unique_ptr<ExpressionExecutor> partition_executor;
+	DataChunk partition_chunk;
+	//! The partition values of the last row of the previous input
+	vector<Value> partition_values;
+	//! Whether a new partition starts at each row of the current input
+	unsafe_unique_array<bool> partition_starts;
+	SelectionVector distinct_sel;
+
 	//	Lead/Lag
 	vector<unique_ptr<LeadLagState>> lead_lag_states;
 };
@@ -298,6 +528,19 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 	}
 }
 
+bool PhysicalStreamingWindow::IsStreamingFrame(ClientContext &context, unique_ptr<Expression> &expr) {
+	auto &wexpr = expr->Cast<BoundWindowExpression>();
+	if (wexpr.type != ExpressionType::WINDOW_AGGREGATE || wexpr.distinct || wexpr.ignore_nulls ||
+	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER || !wexpr.aggregate->combine) {
+		return false;
+	}
+	bool unbounded;
+	idx_t start_offset;
+	idx_t end_offset;
+	return StreamingWindowState::FrameAggregateState::ComputeBounds(context, wexpr, unbounded, start_offset,
+	                                                                end_offset);
+}
+
 unique_ptr<GlobalOperatorState> PhysicalStreamingWindow::GetGlobalOperatorState(ClientContext &context) const {
 	return make_uniq<StreamingWindowGlobalState>();
 }
@@ -408,6 +651,103 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	}
 }
 
+void StreamingWindowState::FrameAggregateState::Execute(ExecutionContext &context, DataChunk &input,
+                                                        const bool *partition_starts, Vector &result) {
+	const idx_t count = input.size();
+
+	// Compute the FILTER mask (if any)
+	ValidityMask filter_mask;
+	if (wexpr.filter_expr) {
+		const auto filtered = filter_executor.SelectExpression(input, filter_sel);
+		if (filtered < count) {
+			filter_mask.Initialize(count);
+			filter_mask.SetAllInvalid(count);
+			for (idx_t f = 0; f < filtered; ++f) {
+				filter_mask.SetValid(filter_sel.get_index(f));
+			}
+		}
+	}
+
+	// Compute the arguments, and iterate through them using a single SV
+	sel_t s = 0;
+	SelectionVector sel(&s);
+	vector<column_t> structs;
+	if (!arg_types.empty()) {
+		executor.Execute(input, arg_chunk);
+		arg_chunk.Flatten();
+		arg_cursor.Reset();
+		arg_cursor.Slice(sel, 1);
+		// This doesn't work for STRUCTs because the SV
+		// is not copied to the children when you slice
+		for (column_t col_idx = 0; col_idx < arg_chunk.ColumnCount(); ++col_idx) {
+			auto &col_vec = arg_cursor.data[col_idx];
+			DictionaryVector::Child(col_vec).Reference(arg_chunk.data[col_idx]);
+			if (col_vec.GetType().InternalType() == PhysicalType::STRUCT) {
+				structs.emplace_back(col_idx);
+			}
+		}
+	}
+
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+	for (idx_t i = 0; i < count; ++i) {
+		if (partition_starts && partition_starts[i]) {
+			Reset();
+		}
+		// Remove the rows that leave the frame
+		const auto row = row_count;
+		while (!unbounded && frame_begin + start_offset < row) {
+			if (frame_begin == front_end) {
+				// No front states left: turn the back rows into suffix states
+				for (idx_t back_row = frame_end - 1; back_row > front_end; back_row--) {
+					Combine(GetState(back_row), GetState(back_row - 1), aggr_input_data);
+				}
+				front_end = frame_end;
+				Destroy(back_state.get());
+				aggregate.initialize(back_state.get());
+			}
+			Destroy(GetState(frame_begin++));
+		}
+
+		// Add the row
+		auto state = GetState(row);
+		aggregate.initialize(state);
+		if (filter_mask.RowIsValid(i)) {
+			sel.set_index(0, i);
+			for (const auto struct_idx : structs) {
+				arg_cursor.data[struct_idx].Slice(arg_chunk.data[struct_idx], sel, 1);
+			}
+			target_ptr = state;
+			aggregate.update(arg_cursor.data.data(), aggr_input_data, arg_cursor.ColumnCount(), target_v, 1);
+		}
+		row_count++;
+
+		// The row that is end_offset rows before this row enters the frame
+		if (row >= end_offset) {
+			const auto entering = frame_end++;
+			Combine(GetState(entering), back_state.get(), aggr_input_data);
+			if (unbounded) {
+				Destroy(GetState(entering));
+			}
+		}
+
+		// The frame is the first front state (if any), followed by the back state
+		if (frame_begin == front_end) {
+			target_ptr = back_state.get();
+		} else if (front_end == frame_end) {
+			target_ptr = GetState(frame_begin);
+		} else {
+			aggregate.initialize(temp_state.get());
+			Combine(GetState(frame_begin), temp_state.get(), aggr_input_data);
+			Combine(back_state.get(), temp_state.get(), aggr_input_data);
+			target_ptr = temp_state.get();
+		}
+		aggregate.finalize(target_v, aggr_input_data, result, 1, i);
+		if (frame_begin != front_end && front_end != frame_end) {
+			Destroy(temp_state.get());
+		}
+	}
+}
+
 OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                     GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
@@ -420,15 +760,23 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 	for (idx_t col_idx = 0; col_idx < input.data.size(); col_idx++) {
 		chunk.data[col_idx].Reference(input.data[col_idx]);
 	}
-	// Compute window function
+	// Compute where the partitions start
 	const idx_t count = input.size();
+	if (state.partition_executor) {
+		state.ComputePartitionStarts(input);
+	}
+	// Compute window function
 	for (idx_t expr_idx = 0; expr_idx < select_list.size(); expr_idx++) {
 		idx_t col_idx = input.data.size() + expr_idx;
 		auto &expr = *select_list[expr_idx];
 		auto &result = chunk.data[col_idx];
 		switch (expr.GetExpressionType()) {
 		case ExpressionType::WINDOW_AGGREGATE:
-			state.aggregate_states[expr_idx]->Execute(context, input, result);
+			if (state.aggregate_states[expr_idx]) {
+				state.aggregate_states[expr_idx]->Execute(context, input, result);
+			} else {
+				state.frame_states[expr_idx]->Execute(context, input, state.partition_starts.get(), result);
+			}
 			break;
 		case ExpressionType::WINDOW_FIRST_VALUE:
 		case ExpressionType::WINDOW_PERCENT_RANK:
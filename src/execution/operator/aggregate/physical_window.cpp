@@ -96,6 +96,8 @@ public:
 	unique_ptr<WindowPartitionGlobalSinkState> global_partition;
 	//! The execution functions
 	Executors executors;
+	//! The function whose frame bounds are reused by each function (or the function itself)
+	vector<idx_t> bounds_sources;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
@@ -208,6 +210,16 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto wexec = WindowExecutorFactory(wexpr, context, mode);
+
+		//	Functions with the same frames share the computation of the frame bounds
+		idx_t bounds_source = expr_idx;
+		for (idx_t prev_idx = 0; prev_idx < expr_idx; ++prev_idx) {
+			if (bounds_sources[prev_idx] == prev_idx && wexec->SharesBounds(*executors[prev_idx])) {
+				bounds_source = prev_idx;
+				break;
+			}
+		}
+		bounds_sources.emplace_back(bounds_source);
 		executors.emplace_back(std::move(wexec));
 	}
 
@@ -729,6 +741,7 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 	scanner->Scan(input_chunk);
 
 	const auto &executors = gsource.gsink.executors;
+	const auto &bounds_sources = gsource.gsink.bounds_sources;
 	auto &gestates = partition_source->window_hash_group->gestates;
 	output_chunk.Reset();
 	for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
@@ -736,7 +749,12 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 		auto &gstate = *gestates[expr_idx];
 		auto &lstate = *read_states[expr_idx];
 		auto &result = output_chunk.data[expr_idx];
-		executor.Evaluate(position, input_chunk, result, lstate, gstate);
+		const auto bounds_source = bounds_sources[expr_idx];
+		if (bounds_source == expr_idx) {
+			executor.Evaluate(position, input_chunk, result, lstate, gstate);
+		} else {
+			executor.Evaluate(position, input_chunk, result, lstate, gstate, read_states[bounds_source].get());
+		}
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
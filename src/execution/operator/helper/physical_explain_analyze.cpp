@@ -21,6 +21,8 @@ SinkFinalizeType PhysicalExplainAnalyze::Finalize(Pipeline &pipeline, Event &eve
                                                   OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<ExplainAnalyzeStateGlobalState>();
 	auto &profiler = QueryProfiler::Get(context);
+	// all operators below the EXPLAIN ANALYZE have finished at this point
+	profiler.RefreshExtraInfo();
 	gstate.analyzed_plan = profiler.ToString();
 	return SinkFinalizeType::READY;
 }
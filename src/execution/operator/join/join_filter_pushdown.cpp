@@ -0,0 +1,252 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+static bool CanPushJoinFilter(JoinType join_type) {
+	// we can only filter the probe side if probe-side tuples without a match never produce output
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return true;
+	default:
+		return false;
+	}
+}
+
+unique_ptr<JoinFilterPushdownInfo> JoinFilterPushdownInfo::Create(const vector<JoinCondition> &conditions,
+                                                                  JoinType join_type, PhysicalOperator &probe_child) {
+	if (!CanPushJoinFilter(join_type)) {
+		return nullptr;
+	}
+	auto result = make_uniq<JoinFilterPushdownInfo>();
+	for (idx_t cond_idx = 0; cond_idx < conditions.size(); cond_idx++) {
+		auto &cond = conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_REF || !DynamicFilter::SupportsType(cond.left->return_type)) {
+			continue;
+		}
+		auto column_index = cond.left->Cast<BoundReferenceExpression>().index;
+		auto scan = PhysicalTableScan::FindDynamicFilterScan(probe_child, column_index);
+		if (!scan) {
+			continue;
+		}
+		JoinFilterPushdownColumn column;
+		column.join_condition = cond_idx;
+		column.filter_data = make_shared_ptr<DynamicFilterData>();
+		if (!scan->table_filters) {
+			scan->table_filters = make_uniq<TableFilterSet>();
+		}
+		scan->table_filters->PushFilter(column_index, make_uniq<DynamicFilter>(column.filter_data));
+		result->columns.push_back(std::move(column));
+	}
+	if (result->columns.empty()) {
+		return nullptr;
+	}
+	return result;
+}
+
+unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState() const {
+	// clear the filters of any previous execution of this plan (e.g. a re-executed prepared statement)
+	for (auto &column : columns) {
+		column.filter_data->Reset();
+	}
+	auto result = make_uniq<JoinFilterGlobalState>();
+	result->columns.resize(columns.size());
+	return result;
+}
+
+unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState() const {
+	auto result = make_uniq<JoinFilterLocalState>();
+	result->columns.resize(columns.size());
+	return result;
+}
+
+static void UpdateMinMax(JoinFilterColumnState &state, const Value &min, const Value &max) {
+	if (state.min.IsNull() || min < state.min) {
+		state.min = min;
+	}
+	if (state.max.IsNull() || max > state.max) {
+		state.max = max;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(Vector &keys, idx_t count, JoinFilterColumnState &state) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	// find the positions of the min and max in this chunk
+	idx_t min_idx = DConstants::INVALID_INDEX;
+	idx_t max_idx = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (min_idx == DConstants::INVALID_INDEX) {
+			min_idx = i;
+			max_idx = i;
+			continue;
+		}
+		if (LessThan::Operation(data[idx], data[vdata.sel->get_index(min_idx)])) {
+			min_idx = i;
+		}
+		if (GreaterThan::Operation(data[idx], data[vdata.sel->get_index(max_idx)])) {
+			max_idx = i;
+		}
+	}
+	if (min_idx == DConstants::INVALID_INDEX) {
+		// all NULL
+		return;
+	}
+	UpdateMinMax(state, keys.GetValue(min_idx), keys.GetValue(max_idx));
+}
+
+static void UpdateMinMax(Vector &keys, idx_t count, JoinFilterColumnState &state) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateMinMax<int8_t>(keys, count, state);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateMinMax<int16_t>(keys, count, state);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateMinMax<int32_t>(keys, count, state);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateMinMax<int64_t>(keys, count, state);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateMinMax<hugeint_t>(keys, count, state);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateMinMax<uint8_t>(keys, count, state);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateMinMax<uint16_t>(keys, count, state);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateMinMax<uint32_t>(keys, count, state);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateMinMax<uint64_t>(keys, count, state);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateMinMax<uhugeint_t>(keys, count, state);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedUpdateMinMax<string_t>(keys, count, state);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
+void JoinFilterPushdownInfo::Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const {
+	const auto count = join_keys.size();
+	// we only keep the actual keys around while the build side can still be pushed as an IN-list
+	const bool collect_values = lstate.count + count <= IN_LIST_THRESHOLD;
+	for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+		auto &keys = join_keys.data[columns[col_idx].join_condition];
+		auto &state = lstate.columns[col_idx];
+		UpdateMinMax(keys, count, state);
+		if (collect_values) {
+			for (idx_t i = 0; i < count; i++) {
+				state.values.push_back(keys.GetValue(i));
+			}
+		} else {
+			state.values.clear();
+		}
+	}
+	lstate.count += count;
+}
+
+void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
+	lock_guard<mutex> guard(gstate.lock);
+	const bool collect_values = gstate.count + lstate.count <= IN_LIST_THRESHOLD;
+	for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+		auto &global_column = gstate.columns[col_idx];
+		auto &local_column = lstate.columns[col_idx];
+		if (!local_column.min.IsNull()) {
+			UpdateMinMax(global_column, local_column.min, local_column.max);
+		}
+		if (collect_values) {
+			for (auto &value : local_column.values) {
+				global_column.values.push_back(std::move(value));
+			}
+		} else {
+			global_column.values.clear();
+		}
+	}
+	gstate.count += lstate.count;
+}
+
+static unique_ptr<TableFilter> CreateInListFilter(const vector<Value> &values) {
+	vector<Value> distinct_values;
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			// NULL never finds a join partner
+			continue;
+		}
+		bool found = false;
+		for (auto &distinct_value : distinct_values) {
+			if (distinct_value == value) {
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			distinct_values.push_back(value);
+		}
+	}
+	D_ASSERT(!distinct_values.empty());
+	if (distinct_values.size() == 1) {
+		return make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(distinct_values[0]));
+	}
+	auto result = make_uniq<ConjunctionOrFilter>();
+	for (auto &value : distinct_values) {
+		result->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(value)));
+	}
+	return std::move(result);
+}
+
+static unique_ptr<TableFilter> CreateRangeFilter(const Value &min, const Value &max) {
+	if (min == max) {
+		return make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, min);
+	}
+	auto result = make_uniq<ConjunctionAndFilter>();
+	result->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, min));
+	result->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, max));
+	return std::move(result);
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate) const {
+	for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+		auto &state = gstate.columns[col_idx];
+		if (state.min.IsNull()) {
+			// no (non-NULL) keys on the build side: nothing to push
+			continue;
+		}
+		unique_ptr<TableFilter> filter;
+		if (gstate.count <= IN_LIST_THRESHOLD) {
+			filter = CreateInListFilter(state.values);
+		} else {
+			filter = CreateRangeFilter(state.min, state.max);
+		}
+		columns[col_idx].filter_data->SetFilter(std::move(filter));
+	}
+}
+
+} // namespace duckdb
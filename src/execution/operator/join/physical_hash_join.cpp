@@ -103,6 +103,10 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			global_filter_state = op.filter_pushdown->GetGlobalState();
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -136,6 +140,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! The state of the runtime filters that are pushed into the probe side (if any)
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +162,11 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+		hash_table->track_heavy_hitters = ClientConfig::GetConfig(context).force_external;
+
+		if (op.filter_pushdown) {
+			local_filter_state = op.filter_pushdown->GetLocalState();
+		}
 	}
 
 public:
@@ -168,6 +180,9 @@ public:
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
 
+	//! Thread-local state of the runtime filters that are pushed into the probe side (if any)
+	unique_ptr<JoinFilterLocalState> local_filter_state;
+
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
@@ -176,6 +191,7 @@ public:
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
 	auto result = make_uniq<JoinHashTable>(BufferManager::GetBufferManager(context), conditions, payload_types,
 	                                       join_type, rhs_output_columns);
+	result->use_bloom_filter = use_bloom_filter;
 	if (!delim_types.empty() && join_type == JoinType::MARK) {
 		// correlated MARK join
 		if (delim_types.size() + 1 == conditions.size()) {
@@ -239,6 +255,10 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	if (filter_pushdown) {
+		filter_pushdown->Sink(lstate.join_keys, *lstate.local_filter_state);
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -257,11 +277,15 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 
 	if (++lstate.chunk_count % HashJoinLocalSinkState::CHUNK_COUNT_UPDATE_INTERVAL == 0) {
 		auto &gstate = input.global_state.Cast<HashJoinGlobalSinkState>();
+		auto &sink_collection = lstate.hash_table->GetSinkCollection();
+		auto ht_size = sink_collection.SizeInBytes() + JoinHashTable::PointerTableSize(sink_collection.Count());
 		if (++gstate.temporary_memory_update_count % gstate.num_threads == 0) {
-			auto &sink_collection = lstate.hash_table->GetSinkCollection();
-			auto ht_size = sink_collection.SizeInBytes() + JoinHashTable::PointerTableSize(sink_collection.Count());
 			gstate.temporary_memory_state->SetRemainingSize(context.client, gstate.num_threads * ht_size);
 		}
+		if (gstate.num_threads * ht_size > gstate.temporary_memory_state->GetReservation()) {
+			// the build side may not fit in memory: from now on, keep track of its heavy hitters for repartitioning
+			lstate.hash_table->track_heavy_hitters = true;
+		}
 	}
 
 	return SinkResultType::NEED_MORE_INPUT;
@@ -275,6 +299,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	}
+	if (filter_pushdown) {
+		filter_pushdown->Combine(*gstate.global_filter_state, *lstate.local_filter_state);
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -460,6 +487,11 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (filter_pushdown) {
+		// the build side is complete: push the runtime filters into the probe side before it starts scanning
+		filter_pushdown->PushFilters(*sink.global_filter_state);
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
@@ -1101,6 +1133,19 @@ string PhysicalHashJoin::ParamsToString() const {
 		result += "Build Max: " + perfect_join_statistics.build_max.ToString() + "\n";
 		result += "\n[INFOSEPARATOR]\n";
 	}
+	if (sink_state && sink_state->Cast<HashJoinGlobalSinkState>().external) {
+		// the number of radix partitions of the external join
+		auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+		result += StringUtil::Format(
+		    "Partitions: %llu\n", RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits()));
+		result += "\n[INFOSEPARATOR]\n";
+	}
+	if (use_bloom_filter && sink_state) {
+		// the number of rows rejected by the Bloom filter so far
+		auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+		result += StringUtil::Format("Bloom Filtered: %llu\n", sink.hash_table->bloom_filter_rejected.load());
+		result += "\n[INFOSEPARATOR]\n";
+	}
 	result += StringUtil::Format("EC: %llu\n", estimated_cardinality);
 	return result;
 }
@@ -0,0 +1,320 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/index/art/leaf.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/storage_lock.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+static DuckTableEntry &GetIndexJoinTable(PhysicalOperator &table_scan) {
+	auto &scan = table_scan.Cast<PhysicalTableScan>();
+	return scan.bind_data->Cast<TableScanBindData>().table;
+}
+
+PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe,
+                                     unique_ptr<PhysicalOperator> table_scan, vector<JoinCondition> cond,
+                                     JoinType join_type, const vector<idx_t> &probe_projection_map,
+                                     const vector<idx_t> &table_projection_map, ART &index, bool probe_first,
+                                     idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::INDEX_JOIN, std::move(cond), join_type, estimated_cardinality),
+      index_name(index.GetIndexName()), index_column(index.GetColumnIds()[0]), table(GetIndexJoinTable(*table_scan)),
+      probe_first(probe_first) {
+	D_ASSERT(join_type == JoinType::INNER);
+	D_ASSERT(conditions.size() == 1);
+
+	children.push_back(std::move(probe));
+	children.push_back(std::move(table_scan));
+
+	for (auto &condition : conditions) {
+		condition_types.push_back(condition.left->return_type);
+	}
+
+	if (probe_projection_map.empty()) {
+		for (idx_t i = 0; i < children[0]->types.size(); i++) {
+			probe_output_columns.push_back(i);
+		}
+	} else {
+		probe_output_columns = probe_projection_map;
+	}
+
+	// translate the output columns of the table scan into the storage ids we fetch from the table
+	auto &scan = children[1]->Cast<PhysicalTableScan>();
+	auto &scan_types = scan.GetTypes();
+	auto fetch_column = [&](idx_t scan_col) {
+		auto column_id = scan.column_ids[scan.projection_ids.empty() ? scan_col : scan.projection_ids[scan_col]];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			fetch_ids.push_back(column_id);
+		} else {
+			fetch_ids.push_back(table.GetColumn(LogicalIndex(column_id)).StorageOid());
+		}
+		fetch_types.push_back(scan_types[scan_col]);
+	};
+	if (table_projection_map.empty()) {
+		for (idx_t i = 0; i < scan_types.size(); i++) {
+			fetch_column(i);
+		}
+	} else {
+		for (auto &scan_col : table_projection_map) {
+			fetch_column(scan_col);
+		}
+	}
+	// the row ids are fetched last, so we can match the fetched rows with the probe-side rows
+	fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	fetch_types.push_back(LogicalType::ROW_TYPE);
+}
+
+string PhysicalIndexJoin::ParamsToString() const {
+	string extra_info = EnumUtil::ToString(join_type) + "\n";
+	for (auto &it : conditions) {
+		string op = ExpressionTypeToOperator(it.comparison);
+		extra_info += it.left->GetName() + " " + op + " " + it.right->GetName() + "\n";
+	}
+	extra_info += "Index: " + index_name + "\n";
+	extra_info += "\n[INFOSEPARATOR]\n";
+	extra_info += StringUtil::Format("EC: %llu\n", estimated_cardinality);
+	return extra_info;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IndexJoinGlobalState : public GlobalOperatorState {
+public:
+	IndexJoinGlobalState(ClientContext &context, const PhysicalIndexJoin &op) {
+		// the index may have been dropped since the plan was created: look it up again under the lock of the indexes
+		// of the table, and keep the table from being checkpointed while we are probing the index
+		auto &storage = op.table.GetStorage();
+		checkpoint_lock = storage.GetSharedCheckpointLock();
+		auto &info = storage.GetDataTableInfo();
+		info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+			if (art.GetIndexName() != op.index_name || art.GetColumnIds()[0] != op.index_column) {
+				return false;
+			}
+			index = &art;
+			return true;
+		});
+		if (!index) {
+			throw CatalogException("Index \"%s\" used by the index join was dropped", op.index_name);
+		}
+
+		// transaction-local appends are not in the index: index them separately
+		auto &transaction = DuckTransaction::Get(context, op.table.catalog);
+		auto &local_storage = LocalStorage::Get(transaction);
+		if (!local_storage.Find(storage)) {
+			return;
+		}
+		vector<unique_ptr<Expression>> unbound_expressions;
+		for (auto &expr : index->unbound_expressions) {
+			unbound_expressions.push_back(expr->Copy());
+		}
+		local_index = make_uniq<ART>(index->GetIndexName(), IndexConstraintType::NONE, index->GetColumnIds(),
+		                             index->table_io_manager, std::move(unbound_expressions), index->db);
+
+		// scan the indexed column and the row ids of the local rows
+		auto index_column = op.index_column;
+		vector<column_t> column_ids {index_column, COLUMN_IDENTIFIER_ROW_ID};
+		DataChunk mock_chunk;
+		mock_chunk.InitializeEmpty(storage.GetTypes());
+		IndexLock index_lock;
+		local_index->InitializeLock(index_lock);
+		local_storage.Scan(storage, column_ids, [&](DataChunk &chunk) -> bool {
+			mock_chunk.data[index_column].Reference(chunk.data[0]);
+			mock_chunk.SetCardinality(chunk);
+			auto error = local_index->Append(index_lock, mock_chunk, chunk.data[1]);
+			if (error.HasError()) {
+				error.Throw();
+			}
+			return true;
+		});
+	}
+
+	//! Keeps the table (and its index) from being checkpointed
+	unique_ptr<StorageLockKey> checkpoint_lock;
+	//! The index that is probed
+	optional_ptr<ART> index;
+	//! An index over the transaction-local appends to the table, if there are any
+	unique_ptr<ART> local_index;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalIndexJoin::GetGlobalOperatorState(ClientContext &context) const {
+	return make_uniq<IndexJoinGlobalState>(context, *this);
+}
+
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : probe_executor(context), arena_allocator(Allocator::Get(context)), keys(STANDARD_VECTOR_SIZE),
+	      match_offset(0), local_match_offset(0), probe_sel(STANDARD_VECTOR_SIZE), matching(false) {
+		auto &allocator = Allocator::Get(context);
+		join_keys.Initialize(allocator, op.condition_types);
+		fetch_chunk.Initialize(allocator, op.fetch_types);
+		for (auto &cond : op.conditions) {
+			probe_executor.AddExpression(*cond.left);
+		}
+	}
+
+	ExpressionExecutor probe_executor;
+	DataChunk join_keys;
+	ArenaAllocator arena_allocator;
+	vector<ARTKey> keys;
+	//! The leaves of the keys in the index
+	vector<Node> leaves;
+
+	//! The row ids that matched the keys of the current input chunk
+	vector<row_t> match_row_ids;
+	//! For each matching row id, the row of the input chunk that it matched
+	vector<sel_t> match_input_rows;
+	//! The number of matches that have been fetched
+	idx_t match_offset;
+	//! The position of the first match in the transaction-local storage
+	idx_t local_match_offset;
+
+	//! The rows fetched from the table
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	ColumnFetchState local_fetch_state;
+	//! The input rows that belong to the fetched rows
+	SelectionVector probe_sel;
+	//! Whether we are still outputting the matches of the current input chunk
+	bool matching;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context.client, *this);
+}
+
+static void ProbeIndex(ART &index, IndexJoinOperatorState &state, idx_t count) {
+	// probe the index for all keys of the chunk at once, while holding the index lock only once
+	IndexLock index_lock;
+	index.InitializeLock(index_lock);
+	index.Lookup(state.keys, count, state.leaves);
+	for (idx_t i = 0; i < count; i++) {
+		if (!state.leaves[i].HasMetadata()) {
+			// no match, or NULL
+			continue;
+		}
+		auto match_count = state.match_row_ids.size();
+		Leaf::GetRowIds(index, state.leaves[i], state.match_row_ids, NumericLimits<idx_t>::Maximum());
+		for (idx_t m = match_count; m < state.match_row_ids.size(); m++) {
+			state.match_input_rows.push_back(UnsafeNumericCast<sel_t>(i));
+		}
+	}
+}
+
+static void LookupIndexMatches(const PhysicalIndexJoin &op, IndexJoinGlobalState &gstate,
+                               IndexJoinOperatorState &state, DataChunk &input) {
+	state.match_row_ids.clear();
+	state.match_input_rows.clear();
+	state.match_offset = 0;
+
+	state.join_keys.Reset();
+	state.probe_executor.Execute(input, state.join_keys);
+
+	state.arena_allocator.Reset();
+	ART::GenerateKeys<>(state.arena_allocator, state.join_keys, state.keys);
+
+	ProbeIndex(*gstate.index, state, input.size());
+	// the matches in the transaction-local storage follow the matches in the table
+	state.local_match_offset = state.match_row_ids.size();
+	if (gstate.local_index) {
+		ProbeIndex(*gstate.local_index, state, input.size());
+	}
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<IndexJoinGlobalState>();
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	if (!state.matching) {
+		LookupIndexMatches(*this, gstate, state, input);
+		state.matching = true;
+	}
+
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+	auto row_id_col = fetch_ids.size() - 1;
+	while (state.match_offset < state.match_row_ids.size()) {
+		// a single fetch reads either from the table or from the transaction-local storage
+		auto local_fetch = state.match_offset >= state.local_match_offset;
+		auto fetch_end = local_fetch ? state.match_row_ids.size() : state.local_match_offset;
+		auto fetch_count = MinValue<idx_t>(fetch_end - state.match_offset, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.match_row_ids.data() + state.match_offset));
+
+		// rows that are not visible to this transaction are skipped by the fetch
+		state.fetch_chunk.Reset();
+		if (local_fetch) {
+			LocalStorage::Get(transaction)
+			    .FetchChunk(storage, row_ids, fetch_count, fetch_ids, state.fetch_chunk, state.local_fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, fetch_ids, row_ids, fetch_count, state.fetch_state);
+		}
+
+		// the fetched rows are a subsequence of the requested rows: find the input row of every fetched row
+		auto fetched_row_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data[row_id_col]);
+		idx_t match_idx = state.match_offset;
+		for (idx_t i = 0; i < state.fetch_chunk.size(); i++) {
+			while (state.match_row_ids[match_idx] != fetched_row_ids[i]) {
+				match_idx++;
+			}
+			state.probe_sel.set_index(i, state.match_input_rows[match_idx++]);
+		}
+		state.match_offset += fetch_count;
+		if (state.fetch_chunk.size() == 0) {
+			continue;
+		}
+
+		idx_t probe_col_offset = probe_first ? 0 : row_id_col;
+		idx_t fetch_col_offset = probe_first ? probe_output_columns.size() : 0;
+		for (idx_t i = 0; i < probe_output_columns.size(); i++) {
+			chunk.data[probe_col_offset + i].Slice(input.data[probe_output_columns[i]], state.probe_sel,
+			                                       state.fetch_chunk.size());
+		}
+		for (idx_t i = 0; i < row_id_col; i++) {
+			chunk.data[fetch_col_offset + i].Reference(state.fetch_chunk.data[i]);
+		}
+		chunk.SetCardinality(state.fetch_chunk.size());
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+
+	// all matches of this input chunk have been output
+	state.matching = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalIndexJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	op_state.reset();
+	auto &state = meta_pipeline.GetState();
+	state.AddPipelineOperator(current, *this);
+	// the table side is only accessed through the index: we only recurse into the probe side
+	children[0]->BuildPipelines(current, meta_pipeline);
+}
+
+vector<const_reference<PhysicalOperator>> PhysicalIndexJoin::GetSources() const {
+	return children[0]->GetSources();
+}
+
+} // namespace duckdb
@@ -6,6 +6,9 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,15 +87,19 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to the top-n, returns true if this has set new boundary values
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
+	void SetBoundaryValues(DataChunk &values);
 
 	void InitializeScan(TopNScanState &state, bool exclude_offset);
 	void Scan(TopNScanState &state, DataChunk &chunk);
 
 	bool CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload);
+	//! Selects the rows of the sort_chunk that sort before the boundary into final_sel, returns the number of rows
+	idx_t SelectBeforeBoundary(DataChunk &sort_chunk, DataChunk &boundary);
 };
 
 //===--------------------------------------------------------------------===//
@@ -275,11 +282,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +313,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -318,9 +326,13 @@ void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_c
 	current_chunk.SetCardinality(1);
 	sort_chunk.Reset();
 	executor.Execute(&current_chunk, sort_chunk);
+	SetBoundaryValues(sort_chunk);
+}
 
+void TopNHeap::SetBoundaryValues(DataChunk &values) {
+	D_ASSERT(values.size() == 1);
 	boundary_values.Reset();
-	boundary_values.Append(sort_chunk);
+	boundary_values.Append(values);
 	boundary_values.SetCardinality(1);
 	for (idx_t i = 0; i < boundary_values.ColumnCount(); i++) {
 		boundary_values.data[i].SetVectorType(VectorType::CONSTANT_VECTOR);
@@ -331,6 +343,18 @@ void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_c
 bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
 	// we have boundary values
 	// from these boundary values, determine which values we should insert (if any)
+	auto final_count = SelectBeforeBoundary(sort_chunk, boundary_values);
+	if (final_count == 0) {
+		return false;
+	}
+	if (final_count < sort_chunk.size()) {
+		sort_chunk.Slice(final_sel, final_count);
+		payload.Slice(final_sel, final_count);
+	}
+	return true;
+}
+
+idx_t TopNHeap::SelectBeforeBoundary(DataChunk &sort_chunk, DataChunk &boundary) {
 	idx_t final_count = 0;
 
 	SelectionVector remaining_sel(nullptr);
@@ -345,23 +369,23 @@ bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
 		idx_t true_count;
 		if (orders[i].null_order == OrderByNullType::NULLS_LAST) {
 			if (orders[i].type == OrderType::ASCENDING) {
-				true_count = VectorOperations::DistinctLessThan(compare_chunk.data[i], boundary_values.data[i],
-				                                                &remaining_sel, remaining_count, &true_sel, &false_sel);
+				true_count = VectorOperations::DistinctLessThan(compare_chunk.data[i], boundary.data[i], &remaining_sel,
+				                                                remaining_count, &true_sel, &false_sel);
 			} else {
-				true_count = VectorOperations::DistinctGreaterThanNullsFirst(compare_chunk.data[i],
-				                                                             boundary_values.data[i], &remaining_sel,
-				                                                             remaining_count, &true_sel, &false_sel);
+				true_count = VectorOperations::DistinctGreaterThanNullsFirst(compare_chunk.data[i], boundary.data[i],
+				                                                             &remaining_sel, remaining_count, &true_sel,
+				                                                             &false_sel);
 			}
 		} else {
 			D_ASSERT(orders[i].null_order == OrderByNullType::NULLS_FIRST);
 			if (orders[i].type == OrderType::ASCENDING) {
-				true_count = VectorOperations::DistinctLessThanNullsFirst(compare_chunk.data[i],
-				                                                          boundary_values.data[i], &remaining_sel,
-				                                                          remaining_count, &true_sel, &false_sel);
+				true_count = VectorOperations::DistinctLessThanNullsFirst(compare_chunk.data[i], boundary.data[i],
+				                                                          &remaining_sel, remaining_count, &true_sel,
+				                                                          &false_sel);
 			} else {
 				true_count =
-				    VectorOperations::DistinctGreaterThan(compare_chunk.data[i], boundary_values.data[i],
-				                                          &remaining_sel, remaining_count, &true_sel, &false_sel);
+				    VectorOperations::DistinctGreaterThan(compare_chunk.data[i], boundary.data[i], &remaining_sel,
+				                                          remaining_count, &true_sel, &false_sel);
 			}
 		}
 
@@ -373,21 +397,14 @@ bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
 		if (!is_last && false_count > 0) {
 			// check what we should continue to check
 			compare_chunk.data[i].Slice(sort_chunk.data[i], false_sel, false_count);
-			remaining_count = VectorOperations::NotDistinctFrom(compare_chunk.data[i], boundary_values.data[i],
-			                                                    &false_sel, false_count, &new_remaining_sel, nullptr);
+			remaining_count = VectorOperations::NotDistinctFrom(compare_chunk.data[i], boundary.data[i], &false_sel,
+			                                                    false_count, &new_remaining_sel, nullptr);
 			remaining_sel.Initialize(new_remaining_sel);
 		} else {
 			break;
 		}
 	}
-	if (final_count == 0) {
-		return false;
-	}
-	if (final_count < sort_chunk.size()) {
-		sort_chunk.Slice(final_sel, final_count);
-		payload.Slice(final_sel, final_count);
-	}
-	return true;
+	return final_count;
 }
 
 void TopNHeap::InitializeScan(TopNScanState &state, bool exclude_offset) {
@@ -398,33 +415,112 @@ void TopNHeap::Scan(TopNScanState &state, DataChunk &chunk) {
 	sort_state.Scan(state, chunk);
 }
 
-class TopNGlobalState : public GlobalSinkState {
+class TopNLocalState : public LocalSinkState {
 public:
-	TopNGlobalState(ClientContext &context, const vector<LogicalType> &payload_types,
-	                const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
+	               const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
+	    : heap(context, payload_types, orders, limit, offset), boundary_version(0) {
 	}
 
-	mutex lock;
 	TopNHeap heap;
+	//! The version of the global boundary values that the heap has seen
+	idx_t boundary_version;
 };
 
-class TopNLocalState : public LocalSinkState {
+class TopNGlobalState : public GlobalSinkState {
 public:
-	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
-	               const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNGlobalState(ClientContext &context, const PhysicalTopN &op)
+	    : op(op), heap(context, op.types, op.orders, op.limit, op.offset), has_boundary_values(false),
+	      boundary_version(0) {
+		vector<LogicalType> sort_types;
+		for (auto &order : op.orders) {
+			sort_types.push_back(order.expression->return_type);
+		}
+		boundary_values.Initialize(BufferAllocator::Get(context), sort_types);
 	}
 
+	const PhysicalTopN &op;
+	mutex lock;
 	TopNHeap heap;
+
+	//! The tightest boundary values of all thread-local heaps
+	mutex boundary_lock;
+	DataChunk boundary_values;
+	bool has_boundary_values;
+	//! Incremented whenever the boundary values are tightened
+	atomic<idx_t> boundary_version;
+
+public:
+	//! Exchanges the boundary values with a thread-local heap: the heap adopts the global boundary values if they are
+	//! tighter than its own, otherwise its boundary values become the global boundary values
+	void UpdateBoundary(TopNLocalState &lstate);
+
+private:
+	void PushFilter();
 };
 
+void TopNGlobalState::UpdateBoundary(TopNLocalState &lstate) {
+	auto &local_heap = lstate.heap;
+	lock_guard<mutex> guard(boundary_lock);
+	lstate.boundary_version = boundary_version;
+	if (!local_heap.has_boundary_values) {
+		if (has_boundary_values) {
+			local_heap.SetBoundaryValues(boundary_values);
+		}
+		return;
+	}
+	if (has_boundary_values && local_heap.SelectBeforeBoundary(boundary_values, local_heap.boundary_values) > 0) {
+		// the global boundary values are tighter: use them to filter the input of the local heap
+		local_heap.SetBoundaryValues(boundary_values);
+		return;
+	}
+	if (has_boundary_values && local_heap.SelectBeforeBoundary(local_heap.boundary_values, boundary_values) == 0) {
+		// the boundary values are equal
+		return;
+	}
+	// the local boundary values are tighter: publish them
+	boundary_values.Reset();
+	boundary_values.Append(local_heap.boundary_values);
+	boundary_values.SetCardinality(1);
+	for (idx_t i = 0; i < boundary_values.ColumnCount(); i++) {
+		boundary_values.data[i].SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+	has_boundary_values = true;
+	lstate.boundary_version = ++boundary_version;
+	PushFilter();
+}
+
+void TopNGlobalState::PushFilter() {
+	if (!op.dynamic_filter) {
+		return;
+	}
+	auto boundary = boundary_values.GetValue(0, 0);
+	if (boundary.IsNull()) {
+		// NULLs sort last: every non-NULL value still sorts before the boundary
+		return;
+	}
+	// if there is a single ORDER BY column, rows that are equal to the boundary cannot make it into the top-n either
+	auto &order = op.orders[0];
+	const bool inclusive = op.orders.size() > 1;
+	ExpressionType comparison;
+	if (order.type == OrderType::ASCENDING) {
+		comparison = inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+	} else {
+		comparison = inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO : ExpressionType::COMPARE_GREATERTHAN;
+	}
+	op.dynamic_filter->SetFilter(make_uniq<ConstantFilter>(comparison, std::move(boundary)));
+}
+
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) const {
 	return make_uniq<TopNLocalState>(context, types, orders, limit, offset);
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	if (dynamic_filter) {
+		// clear the filter of any previous execution of this plan (e.g. a re-executed prepared statement)
+		dynamic_filter->Reset();
+	}
+	return make_uniq<TopNGlobalState>(context, *this);
 }
 
 //===--------------------------------------------------------------------===//
@@ -432,9 +528,13 @@ unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &cont
 //===--------------------------------------------------------------------===//
 SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	// append to the local sink state
+	auto &gstate = input.global_state.Cast<TopNGlobalState>();
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() || sink.boundary_version != gstate.boundary_version) {
+		// share the boundary values with the other threads (and the table scan)
+		gstate.UpdateBoundary(sink);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -492,6 +592,32 @@ SourceResultType PhysicalTopN::GetData(ExecutionContext &context, DataChunk &chu
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
 
+void PhysicalTopN::PushDynamicFilter() {
+	D_ASSERT(children.size() == 1);
+	if (orders.empty()) {
+		return;
+	}
+	auto &order = orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// the filter would remove the NULLs that sort before the boundary
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_REF ||
+	    !DynamicFilter::SupportsType(order.expression->return_type)) {
+		return;
+	}
+	auto column_index = order.expression->Cast<BoundReferenceExpression>().index;
+	auto scan = PhysicalTableScan::FindDynamicFilterScan(*children[0], column_index);
+	if (!scan) {
+		return;
+	}
+	dynamic_filter = make_shared_ptr<DynamicFilterData>();
+	if (!scan->table_filters) {
+		scan->table_filters = make_uniq<TableFilterSet>();
+	}
+	scan->table_filters->PushFilter(column_index, make_uniq<DynamicFilter>(dynamic_filter));
+}
+
 string PhysicalTopN::ParamsToString() const {
 	string result;
 	result += "Top " + to_string(limit);
@@ -2,6 +2,9 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -121,6 +124,55 @@ idx_t PhysicalTableScan::GetBatchIndex(ExecutionContext &context, DataChunk &chu
 	                                gstate.global_state.get());
 }
 
+static bool SupportsDynamicFilters(const TableFunction &function) {
+	if (!function.filter_pushdown) {
+		return false;
+	}
+	// only our own table scan and the Parquet reader know how to deal with dynamic filters
+	return function.name == "seq_scan" || function.name == "parquet_scan" || function.name == "read_parquet";
+}
+
+optional_ptr<PhysicalTableScan> PhysicalTableScan::FindDynamicFilterScan(PhysicalOperator &op, idx_t &column_index) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!SupportsDynamicFilters(scan.function)) {
+			return nullptr;
+		}
+		if (!scan.projection_ids.empty()) {
+			column_index = scan.projection_ids[column_index];
+		}
+		if (scan.column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+		return &scan;
+	}
+	case PhysicalOperatorType::PROJECTION: {
+		auto &expr = *op.Cast<PhysicalProjection>().select_list[column_index];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_index = expr.Cast<BoundReferenceExpression>().index;
+		return FindDynamicFilterScan(*op.children[0], column_index);
+	}
+	case PhysicalOperatorType::FILTER:
+		return FindDynamicFilterScan(*op.children[0], column_index);
+	case PhysicalOperatorType::HASH_JOIN: {
+		// the hash join emits the probe-side columns first (except for RIGHT_SEMI/RIGHT_ANTI joins)
+		auto &join = op.Cast<PhysicalHashJoin>();
+		if (join.join_type == JoinType::RIGHT_SEMI || join.join_type == JoinType::RIGHT_ANTI) {
+			return nullptr;
+		}
+		if (column_index >= join.children[0]->types.size()) {
+			return nullptr;
+		}
+		return FindDynamicFilterScan(*join.children[0], column_index);
+	}
+	default:
+		return nullptr;
+	}
+}
+
 string PhysicalTableScan::GetName() const {
 	return StringUtil::Upper(function.name + " " + function.extra_info);
 }
@@ -155,16 +207,25 @@ string PhysicalTableScan::ParamsToString() const {
 		}
 	}
 	if (function.filter_pushdown && table_filters) {
-		result += "\n[INFOSEPARATOR]\n";
-		result += "Filters: ";
+		string filters_str;
 		for (auto &f : table_filters->filters) {
 			auto &column_index = f.first;
 			auto &filter = f.second;
 			if (column_index < names.size()) {
-				result += filter->ToString(names[column_ids[column_index]]);
-				result += "\n";
+				auto filter_str = filter->ToString(names[column_ids[column_index]]);
+				if (filter_str.empty()) {
+					// dynamic filters that have not been set (yet) are not displayed
+					continue;
+				}
+				filters_str += filter_str;
+				filters_str += "\n";
 			}
 		}
+		if (!filters_str.empty()) {
+			result += "\n[INFOSEPARATOR]\n";
+			result += "Filters: ";
+			result += filters_str;
+		}
 	}
 	if (!extra_info.file_filters.empty()) {
 		result += "\n[INFOSEPARATOR]\n";
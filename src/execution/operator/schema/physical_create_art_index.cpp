@@ -16,10 +16,10 @@ namespace duckdb {
 PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table_p,
                                                const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
                                                vector<unique_ptr<Expression>> unbound_expressions,
-                                               idx_t estimated_cardinality, const bool sorted)
+                                               idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
-      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)), unbound_expressions(std::move(unbound_expressions)),
-      sorted(sorted) {
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
 
 	// convert virtual column ids to storage column ids
 	for (auto &column_id : column_ids) {
@@ -43,9 +43,15 @@ public:
 
 	unique_ptr<BoundIndex> local_index;
 	ArenaAllocator arena_allocator;
-	vector<ARTKey> keys;
+	//! The keys of the current chunk
+	vector<ARTKey> chunk_keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! The buffered keys and their row IDs, which have not been added to the local index yet
+	vector<ARTKey> keys;
+	vector<row_t> row_ids;
+	idx_t key_count = 0;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -68,7 +74,7 @@ unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionCo
 	state->local_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
 	                                    TableIOManager::Get(storage), unbound_expressions, storage.db);
 
-	state->keys = vector<ARTKey>(STANDARD_VECTOR_SIZE);
+	state->chunk_keys = vector<ARTKey>(STANDARD_VECTOR_SIZE);
 	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
 
 	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
@@ -77,37 +83,18 @@ unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionCo
 	return std::move(state);
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto count = l_state.key_chunk.size();
-
-	UnifiedVectorFormat row_id_data;
-	row_identifiers.ToUnifiedFormat(count, row_id_data);
-	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
-
-	// insert the row IDs
-	auto &art = l_state.local_index->Cast<ART>();
-	for (idx_t i = 0; i < count; i++) {
-		if (!art.Insert(art.tree, l_state.keys[i], 0, row_ids[i])) {
-			throw ConstraintException("Data contains duplicates on indexed column(s)");
-		}
+static void ConstructFromBufferedKeys(CreateARTIndexLocalSinkState &l_state, const string &index_name,
+                                      DataTable &storage) {
+	if (l_state.key_count == 0) {
+		return;
 	}
 
-	return SinkResultType::NEED_MORE_INPUT;
-}
-
-SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto &storage = table.GetStorage();
+	// sort the buffered keys once, and construct an ART bottom-up from them
 	auto &l_index = l_state.local_index;
-
-	// create an ART from the chunk
-	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
+	auto art = make_uniq<ART>(index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
 	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
 	                          l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
+	if (!art->Construct(l_state.key_count, l_state.keys, l_state.row_ids)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
@@ -116,7 +103,8 @@ SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, Opera
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
-	return SinkResultType::NEED_MORE_INPUT;
+	l_state.key_count = 0;
+	l_state.arena_allocator.Reset();
 }
 
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
@@ -125,17 +113,32 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 	D_ASSERT(chunk.ColumnCount() >= 2);
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	l_state.arena_allocator.Reset();
 
-	// Insert the keys and their corresponding row identifiers.
+	// the NULL filter below this operator guarantees that the keys are not NULL
+	auto count = l_state.key_chunk.size();
+	ART::GenerateKeys<true>(l_state.arena_allocator, l_state.key_chunk, l_state.chunk_keys);
+
+	// buffer the keys and their row IDs, the key data stays in the arena allocator
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
-	if (sorted) {
-		ART::GenerateKeys<true>(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
-		return SinkSorted(row_identifiers, input);
+	UnifiedVectorFormat row_id_data;
+	row_identifiers.ToUnifiedFormat(count, row_id_data);
+	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+
+	auto new_count = l_state.key_count + count;
+	if (new_count > l_state.keys.size()) {
+		l_state.keys.resize(MaxValue<idx_t>(new_count, l_state.keys.size() * 2));
+		l_state.row_ids.resize(l_state.keys.size());
 	}
+	for (idx_t i = 0; i < count; i++) {
+		l_state.keys[l_state.key_count + i] = l_state.chunk_keys[i];
+		l_state.row_ids[l_state.key_count + i] = row_ids[row_id_data.sel->get_index(i)];
+	}
+	l_state.key_count = new_count;
 
-	ART::GenerateKeys(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
-	return SinkUnsorted(row_identifiers, input);
+	if (l_state.key_count >= BULK_CONSTRUCT_THRESHOLD) {
+		ConstructFromBufferedKeys(l_state, info->index_name, table.GetStorage());
+	}
+	return SinkResultType::NEED_MORE_INPUT;
 }
 
 SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
@@ -143,6 +146,7 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	ConstructFromBufferedKeys(l_state, info->index_name, table.GetStorage());
 
 	// merge the local index into the global index
 	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
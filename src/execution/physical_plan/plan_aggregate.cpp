@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -9,8 +10,11 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 
 namespace duckdb {
 
@@ -149,10 +153,51 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool CanUseStreamingAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys) {
+			return false;
+		}
+	}
+	// the groups have to be column references
+	vector<idx_t> columns;
+	for (auto &group : op.groups) {
+		if (group->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	// look through the projections below the aggregate for an ORDER BY on exactly the groups
+	auto order = PhysicalPlanGenerator::FindOrderedInput(*op.children[0], columns);
+	if (!order) {
+		return false;
+	}
+	unordered_set<idx_t> group_columns(columns.begin(), columns.end());
+	if (order->orders.size() < group_columns.size()) {
+		return false;
+	}
+	// the leading ORDER BY expressions have to be the groups (in any order and direction)
+	unordered_set<idx_t> order_columns;
+	for (idx_t order_idx = 0; order_idx < group_columns.size(); order_idx++) {
+		auto &expr = *order->orders[order_idx].expression;
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		order_columns.insert(expr.Cast<BoundReferenceExpression>().index);
+	}
+	return order_columns == group_columns;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// check if the input is ordered on the groups before the child is planned (and the logical plan is consumed)
+	bool use_streaming_aggregate = CanUseStreamingAggregate(op);
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -180,7 +225,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_streaming_aggregate) {
+			// the input is ordered on the groups: aggregate one group at a time
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -2,6 +2,7 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
@@ -10,6 +11,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -121,6 +123,26 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+static bool UseJoinBloomFilter(ClientContext &context, LogicalComparisonJoin &op, idx_t lhs_cardinality,
+                               idx_t rhs_cardinality) {
+	switch (op.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		// the estimated cardinality of these joins is the number of matches
+		break;
+	default:
+		return false;
+	}
+	// the Bloom filter only saves cache misses if the pointer table does not fit in the CPU cache
+	if (rhs_cardinality < JoinHashTable::BLOOM_FILTER_THRESHOLD) {
+		return false;
+	}
+	// and only pays off if we expect most of the probe-side rows to not find a match
+	return op.EstimateCardinality(context) * 2 < lhs_cardinality;
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -129,6 +151,82 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+static optional_ptr<ART> FindJoinIndex(ClientContext &context, PhysicalOperator &plan, Expression &join_key) {
+	// the side must be a plain scan over a base table
+	if (plan.type != PhysicalOperatorType::TABLE_SCAN) {
+		return nullptr;
+	}
+	auto &scan = plan.Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return nullptr;
+	}
+	if (scan.table_filters && !scan.table_filters->filters.empty()) {
+		// the index join does not evaluate table filters
+		return nullptr;
+	}
+	// that is joined on one of its columns
+	if (join_key.type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	auto key_idx = join_key.Cast<BoundReferenceExpression>().index;
+	auto column_id = scan.column_ids[scan.projection_ids.empty() ? key_idx : scan.projection_ids[key_idx]];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+	auto &storage = table.GetStorage();
+
+	// find an ART over exactly that column
+	auto storage_id = table.GetColumn(LogicalIndex(column_id)).StorageOid();
+	optional_ptr<ART> result;
+	auto checkpoint_lock = storage.GetSharedCheckpointLock();
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+		if (art.unbound_expressions.size() != 1 ||
+		    art.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		if (art.GetColumnIds()[0] != storage_id) {
+			return false;
+		}
+		result = &art;
+		return true;
+	});
+	return result;
+}
+
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right, idx_t lhs_cardinality,
+                                                  idx_t rhs_cardinality) {
+	// probing the index only pays off if the probe side is much smaller than the indexed table
+	static constexpr const double INDEX_JOIN_RATIO = 100;
+
+	if (op.join_type != JoinType::INNER || op.conditions.size() != 1 ||
+	    op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	auto force_index_join = ClientConfig::GetConfig(context).force_index_join;
+	auto &condition = op.conditions[0];
+
+	auto right_index = FindJoinIndex(context, *right, *condition.right);
+	if (right_index && (force_index_join || double(lhs_cardinality) * INDEX_JOIN_RATIO < double(rhs_cardinality))) {
+		return make_uniq<PhysicalIndexJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
+		                                    op.join_type, op.left_projection_map, op.right_projection_map,
+		                                    *right_index, true, op.estimated_cardinality);
+	}
+	auto left_index = FindJoinIndex(context, *left, *condition.left);
+	if (left_index && (force_index_join || double(rhs_cardinality) * INDEX_JOIN_RATIO < double(lhs_cardinality))) {
+		// the index is on the LHS: the RHS becomes the probe side
+		std::swap(condition.left, condition.right);
+		return make_uniq<PhysicalIndexJoin>(op, std::move(right), std::move(left), std::move(op.conditions),
+		                                    op.join_type, op.right_projection_map, op.left_projection_map,
+		                                    *left_index, false, op.estimated_cardinality);
+	}
+	return nullptr;
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -191,12 +289,24 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		// Equality join on an indexed column of a much larger table: probe the index instead of building a hash table
+		plan = PlanIndexJoin(context, op, left, right, lhs_cardinality, rhs_cardinality);
+		if (plan) {
+			return plan;
+		}
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->use_bloom_filter = UseJoinBloomFilter(context, op, lhs_cardinality, rhs_cardinality);
+		if (client_config.enable_join_filter_pushdown) {
+			// push runtime filters derived from the build side into the probe-side table scan
+			hash_join->filter_pushdown = JoinFilterPushdownInfo::Create(hash_join->conditions, hash_join->join_type,
+			                                                            *hash_join->children[0]);
+		}
+		plan = std::move(hash_join);
 
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
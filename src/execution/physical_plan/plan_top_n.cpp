@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -12,6 +13,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op)
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
 	top_n->children.push_back(std::move(plan));
+	if (ClientConfig::GetConfig(context).enable_top_n_filter_pushdown) {
+		// push the boundary of the top-n into the table scan as a runtime filter
+		top_n->PushDynamicFilter();
+	}
 	return std::move(top_n);
 }
 
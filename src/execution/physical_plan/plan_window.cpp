@@ -5,15 +5,74 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_window.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace duckdb {
 
+//! Whether the input of the window is ordered on the partitions (in any order and direction), followed by the orders
+//! of the window expression
+static bool IsOrderedOnWindow(LogicalOperator &input, BoundWindowExpression &wexpr) {
+	// the partitions and orders have to be column references
+	vector<idx_t> columns;
+	for (auto &partition : wexpr.partitions) {
+		if (partition->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(partition->Cast<BoundReferenceExpression>().index);
+	}
+	for (auto &order : wexpr.orders) {
+		if (order.expression->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(order.expression->Cast<BoundReferenceExpression>().index);
+	}
+	auto order = PhysicalPlanGenerator::FindOrderedInput(input, columns);
+	if (!order || order->orders.size() < columns.size()) {
+		return false;
+	}
+	unordered_set<idx_t> partition_columns;
+	unordered_set<idx_t> order_columns;
+	for (idx_t order_idx = 0; order_idx < columns.size(); order_idx++) {
+		auto &node = order->orders[order_idx];
+		if (node.expression->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		auto column = node.expression->Cast<BoundReferenceExpression>().index;
+		if (order_idx < wexpr.partitions.size()) {
+			partition_columns.insert(columns[order_idx]);
+			order_columns.insert(column);
+			continue;
+		}
+		auto &window_order = wexpr.orders[order_idx - wexpr.partitions.size()];
+		if (column != columns[order_idx] || node.type != window_order.type ||
+		    node.null_order != window_order.null_order) {
+			return false;
+		}
+	}
+	return partition_columns == order_columns;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	D_ASSERT(op.children.size() == 1);
 
+	// Identify windows over bounded frames that can be streamed, because the input is already ordered on the window.
+	// This is checked before the child is planned (and the logical plan is consumed)
+	const bool enable_optimizer = ClientConfig::GetConfig(context).enable_optimizer;
+	vector<idx_t> framed_windows;
+	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
+		if (!enable_optimizer || PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx]) ||
+		    !PhysicalStreamingWindow::IsStreamingFrame(context, op.expressions[expr_idx])) {
+			continue;
+		}
+		if (IsOrderedOnWindow(*op.children[0], op.expressions[expr_idx]->Cast<BoundWindowExpression>())) {
+			framed_windows.push_back(expr_idx);
+		}
+	}
+
 	auto plan = CreatePlan(*op.children[0]);
 #ifdef DEBUG
 	for (auto &expr : op.expressions) {
@@ -29,16 +88,22 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	types.resize(input_width);
 
 	// Identify streaming windows
-	const bool enable_optimizer = ClientConfig::GetConfig(context).enable_optimizer;
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
 		if (enable_optimizer && PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx])) {
 			streaming_windows.push_back(expr_idx);
-		} else {
+		} else if (std::find(framed_windows.begin(), framed_windows.end(), expr_idx) == framed_windows.end()) {
 			blocking_windows.push_back(expr_idx);
 		}
 	}
+	// The blocking windows are evaluated first and do not preserve the order of the input
+	if (blocking_windows.empty()) {
+		streaming_windows.insert(streaming_windows.end(), framed_windows.begin(), framed_windows.end());
+	} else {
+		blocking_windows.insert(blocking_windows.end(), framed_windows.begin(), framed_windows.end());
+		std::sort(blocking_windows.begin(), blocking_windows.end());
+	}
 
 	// Process the window functions by sharing the partition/order definitions
 	unordered_map<idx_t, idx_t> projection_map;
@@ -6,6 +6,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/operator/logical_extension_operator.hpp"
 #include "duckdb/planner/operator/list.hpp"
@@ -240,4 +241,57 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOperator &
 	return plan;
 }
 
+//! Returns the column that is referenced by a projection expression, if the expression is a column reference (or the
+//! compression/decompression of a column reference, which preserves both equality and order)
+static optional_ptr<BoundReferenceExpression> GetReferencedColumn(Expression &expr) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		return &expr.Cast<BoundReferenceExpression>();
+	}
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (!StringUtil::StartsWith(func.function.name, "__internal_compress") &&
+	    !StringUtil::StartsWith(func.function.name, "__internal_decompress")) {
+		return nullptr;
+	}
+	if (func.children.empty() || func.children[0]->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+		return nullptr;
+	}
+	// the remaining arguments (e.g., the minimum value of the column) must be constant
+	for (idx_t i = 1; i < func.children.size(); i++) {
+		if (!func.children[i]->IsFoldable()) {
+			return nullptr;
+		}
+	}
+	return &func.children[0]->Cast<BoundReferenceExpression>();
+}
+
+optional_ptr<LogicalOrder> PhysicalPlanGenerator::FindOrderedInput(LogicalOperator &input, vector<idx_t> &columns) {
+	// note that we cannot use the min/max statistics of a table scan here: these only tell us that row groups are
+	// disjoint, not that the rows within a row group are ordered
+	reference<LogicalOperator> child = input;
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &projection = child.get().Cast<LogicalProjection>();
+		for (auto &column : columns) {
+			auto ref = GetReferencedColumn(*projection.expressions[column]);
+			if (!ref) {
+				return nullptr;
+			}
+			column = ref->index;
+		}
+		child = *projection.children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_ORDER_BY) {
+		return nullptr;
+	}
+	auto &order = child.get().Cast<LogicalOrder>();
+	if (!order.projections.empty()) {
+		for (auto &column : columns) {
+			column = order.projections[column];
+		}
+	}
+	return &order;
+}
+
 } // namespace duckdb
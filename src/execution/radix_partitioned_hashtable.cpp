@@ -1,5 +1,6 @@
 #include "duckdb/execution/radix_partitioned_hashtable.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/row/tuple_data_collection.hpp"
@@ -142,6 +143,13 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If the HT creates a new group for at least this fraction of rows, we skip the lookups
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
+	//! While skipping the lookups, we do the lookups again every this many times that the HT would have filled up, to
+	//! check whether the HT still does not reduce the data
+	static constexpr const idx_t SKIP_LOOKUPS_RESAMPLE_INTERVAL = 8;
+	//! Partitions that are larger than this fraction of the memory limit are repartitioned while finalizing them
+	static constexpr const double MAXIMUM_FINALIZE_MEMORY_RATIO = 0.5;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -191,6 +199,13 @@ public:
 	idx_t count_before_combining;
 	//! Maximum partition size if all unique
 	idx_t max_partition_size;
+
+	//! Statistics for the profiler
+	atomic<idx_t> spill_size;
+	atomic<idx_t> partition_count;
+	atomic<idx_t> finalize_repartitions;
+	atomic<idx_t> finalize_waits;
+	atomic<idx_t> skipped_lookups;
 };
 
 RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const RadixPartitionedHashTable &radix_ht_p)
@@ -198,7 +213,8 @@ RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const R
       radix_ht(radix_ht_p), config(context, *this), finalized(false), external(false), active_threads(0),
       number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
       any_combined(false), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
-      count_before_combining(0), max_partition_size(0) {
+      count_before_combining(0), max_partition_size(0), spill_size(0), partition_count(0), finalize_repartitions(0),
+      finalize_waits(0), skipped_lookups(0) {
 
 	auto tuples_per_block = Storage::BLOCK_ALLOC_SIZE / radix_ht.GetLayout().GetRowWidth();
 	idx_t ht_count =
@@ -327,12 +343,20 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Number of rows sunk / groups created since we've last decided whether to skip the lookups
+	idx_t sink_count;
+	idx_t new_group_count;
+	//! Number of times that the HT would have filled up since we've started skipping the lookups
+	idx_t skip_lookups_fills;
+	//! Number of rows that were sunk without doing lookups
+	idx_t skipped_lookups;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), new_group_count(0), skip_lookups_fills(0), skipped_lookups(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -398,6 +422,7 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 			}
 
 			ht.UnpinData();
+			gstate.spill_size += partitioned_data->SizeInBytes();
 			partitioned_data->Repartition(*lstate.abandoned_data);
 			ht.SetRadixBits(gstate.config.GetRadixBits());
 			ht.InitializePartitionedData();
@@ -448,12 +473,46 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.new_group_count += ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
+
+	if (ht.SkipLookups()) {
+		// We're not filling the pointer table, check whether we need to repartition every time we've sunk as much
+		lstate.skipped_lookups += group_chunk.size();
+		if (lstate.sink_count + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
+			return;
+		}
+		lstate.sink_count = 0;
+		lstate.new_group_count = 0;
+		if (++lstate.skip_lookups_fills == gstate.config.SKIP_LOOKUPS_RESAMPLE_INTERVAL) {
+			// The distribution of the keys may have changed, do the lookups again until the HT fills up, so that we
+			// measure the reduction again (the pointer table is still empty, the appended rows are not in it)
+			lstate.skip_lookups_fills = 0;
+			ht.SetSkipLookups(false);
+		}
+		MaybeRepartition(context.client, gstate, lstate);
+		return;
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
+	// The pointer table is full, check how much the HT reduced the data since we last got here
+	const auto reduction_ratio = static_cast<double>(lstate.new_group_count) / static_cast<double>(lstate.sink_count);
+	lstate.sink_count = 0;
+	lstate.new_group_count = 0;
+	if (gstate.number_of_threads > 1 && reduction_ratio >= gstate.config.SKIP_LOOKUPS_THRESHOLD) {
+		// (Almost) all groups are unique, probing the HT does not pay off: from now on we just append the rows to the
+		// partitioned data, and combine the groups when finalizing the partitions
+		// We don't do this with 1 thread, the finalize does not combine the data of a single HT
+		ht.ClearPointerTable();
+		ht.ResetCount();
+		ht.SetSkipLookups(true);
+		MaybeRepartition(context.client, gstate, lstate);
+		return;
+	}
+
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
@@ -484,10 +543,14 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 
 	// Set any_combined, then check one last time whether we need to repartition
 	gstate.any_combined = true;
+	gstate.skipped_lookups += lstate.skipped_lookups;
 	MaybeRepartition(context.client, gstate, lstate);
 
 	auto &ht = *lstate.ht;
 	ht.UnpinData();
+	if (gstate.external) {
+		gstate.spill_size += ht.GetPartitionedData()->SizeInBytes();
+	}
 
 	if (lstate.abandoned_data) {
 		D_ASSERT(gstate.external);
@@ -535,12 +598,25 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 				gstate.partitions.back()->state = AggregatePartitionState::READY_TO_SCAN;
 			}
 		}
+		if (!single_ht) {
+			// Schedule the largest partitions first, so that they don't end up being finalized last, by a single thread
+			std::stable_sort(gstate.partitions.begin(), gstate.partitions.end(),
+			                 [](const unique_ptr<AggregatePartition> &lhs, const unique_ptr<AggregatePartition> &rhs) {
+				                 return lhs->data->SizeInBytes() > rhs->data->SizeInBytes();
+			                 });
+		}
+		gstate.partition_count = gstate.partitions.size();
 	} else {
 		gstate.count_before_combining = 0;
 	}
 
-	// Minimum of combining one partition at a time
-	gstate.temporary_memory_state->SetMinimumReservation(gstate.max_partition_size);
+	// Minimum of combining one partition at a time, but partitions that are too large to fit are repartitioned while
+	// finalizing them, so we don't need to reserve more than a fraction of the memory limit
+	const auto memory_limit = MinValue<idx_t>(BufferManager::GetBufferManager(context).GetMaxMemory(),
+	                                          TemporaryMemoryManager::GetQueryMemoryLimit(context));
+	const auto finalize_limit =
+	    NumericCast<idx_t>(RadixHTConfig::MAXIMUM_FINALIZE_MEMORY_RATIO * static_cast<double>(memory_limit));
+	gstate.temporary_memory_state->SetMinimumReservation(MinValue(gstate.max_partition_size, finalize_limit));
 	// Maximum of combining all partitions
 	auto max_threads = MinValue<idx_t>(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()),
 	                                   gstate.partitions.size());
@@ -572,6 +648,15 @@ void RadixPartitionedHashTable::SetMultiScan(GlobalSinkState &sink_p) {
 	sink.scan_pin_properties = TupleDataPinProperties::UNPIN_AFTER_DONE;
 }
 
+void RadixPartitionedHashTable::GetStatistics(GlobalSinkState &sink_p, RadixHTStatistics &result) {
+	auto &sink = sink_p.Cast<RadixHTGlobalSinkState>();
+	result.spill_size += sink.spill_size;
+	result.partition_count += sink.partition_count;
+	result.finalize_repartitions += sink.finalize_repartitions;
+	result.finalize_waits += sink.finalize_waits;
+	result.skipped_lookups += sink.skipped_lookups;
+}
+
 enum class RadixHTSourceTaskType : uint8_t { NO_TASK, FINALIZE, SCAN };
 
 class RadixHTLocalSourceState;
@@ -613,6 +698,10 @@ public:
 private:
 	//! Execute the finalize or scan task
 	void Finalize(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate);
+	//! Combines the data into the result using this thread's HT, recursively repartitioning the data if it does not
+	//! fit within the memory limit
+	void Combine(RadixHTGlobalSinkState &sink, TupleDataCollection &data, idx_t radix_bits, idx_t memory_limit,
+	             TupleDataCollection &result, optional_ptr<atomic<double>> progress);
 	void Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate, DataChunk &chunk);
 
 public:
@@ -674,6 +763,7 @@ SourceResultType RadixHTGlobalSourceState::AssignTask(RadixHTGlobalSinkState &si
 		lstate.task = RadixHTSourceTaskType::SCAN;
 		lstate.scan_status = RadixHTScanStatus::INIT;
 		partition.blocked_tasks.push_back(interrupt_state);
+		sink.finalize_waits++;
 		return SourceResultType::BLOCKED;
 	case AggregatePartitionState::READY_TO_SCAN:
 		lstate.task = RadixHTSourceTaskType::SCAN;
@@ -731,22 +821,18 @@ void RadixHTLocalSourceState::Finalize(RadixHTGlobalSinkState &sink, RadixHTGlob
 		    MaxValue(NextPowerOfTwo(thread_limit / size_per_entry), GroupedAggregateHashTable::InitialCapacity());
 
 		ht = sink.radix_ht.CreateHT(gstate.context, MinValue<idx_t>(capacity, capacity_limit), 0);
-	} else {
-		// We may want to resize here to the size of this partition, but for now we just assume uniform partition sizes
-		ht->InitializePartitionedData();
-		ht->ClearPointerTable();
-		ht->ResetCount();
 	}
+	// We may want to resize here to the size of this partition, but for now we just assume uniform partition sizes
 
-	// Now combine the uncombined data using this thread's HT
-	ht->Combine(*partition.data, &partition.progress);
-	ht->UnpinData();
-	partition.progress = 1;
-
-	// Move the combined data back to the partition
-	partition.data =
+	// Now combine the uncombined data using this thread's HT, and move the combined data back to the partition
+	const auto radix_bits = RadixPartitioning::RadixBits(sink.partitions.size());
+	const auto memory_limit =
+	    sink.temporary_memory_state->GetReservation() / MaxValue<idx_t>(sink.radix_ht.MaxThreads(sink), 1);
+	auto combined_data =
 	    make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(gstate.context), sink.radix_ht.GetLayout());
-	partition.data->Combine(*ht->GetPartitionedData()->GetPartitions()[0]);
+	Combine(sink, *partition.data, radix_bits, memory_limit, *combined_data, &partition.progress);
+	partition.data = std::move(combined_data);
+	partition.progress = 1;
 
 	// Update thread-global state
 	lock_guard<mutex> global_guard(sink.lock);
@@ -771,6 +857,68 @@ void RadixHTLocalSourceState::Finalize(RadixHTGlobalSinkState &sink, RadixHTGlob
 	scan_status = RadixHTScanStatus::INIT;
 }
 
+void RadixHTLocalSourceState::Combine(RadixHTGlobalSinkState &sink, TupleDataCollection &data, idx_t radix_bits,
+                                      idx_t memory_limit, TupleDataCollection &result,
+                                      optional_ptr<atomic<double>> progress) {
+	const auto data_size =
+	    data.SizeInBytes() + GroupedAggregateHashTable::GetCapacityForCount(data.Count()) * sizeof(ht_entry_t);
+	if (data_size <= memory_limit || radix_bits >= RadixPartitioning::MAX_RADIX_BITS) {
+		ht->Combine(data, progress);
+		ht->UnpinData();
+		result.Combine(*ht->GetPartitionedData()->GetPartitions()[0]);
+
+		ht->InitializePartitionedData();
+		ht->ClearPointerTable();
+		ht->ResetCount();
+		return;
+	}
+
+	// The data does not fit, split it up further using the next radix bits of the hash, so that we can combine the
+	// resulting partitions one at a time. The groups of different partitions are disjoint, so the combined partitions
+	// can simply be appended to the result
+	// Every partition holds on to a block while we're appending to it, so we limit the fan-out to what fits in the
+	// memory limit, partitions that are still too large are split up again when we combine them
+	const auto max_partition_factor = MaxValue<idx_t>(PreviousPowerOfTwo(memory_limit / Storage::BLOCK_ALLOC_SIZE),
+	                                                  RadixPartitioning::NumberOfPartitions(1));
+	const auto partition_factor =
+	    MinValue(NextPowerOfTwo((data_size + memory_limit - 1) / memory_limit), max_partition_factor);
+	const auto new_radix_bits =
+	    MinValue(radix_bits + RadixPartitioning::RadixBits(partition_factor), RadixPartitioning::MAX_RADIX_BITS);
+	const auto &data_layout = data.GetLayout();
+	RadixPartitionedTupleData partitioned_data(BufferManager::GetBufferManager(sink.context), data_layout,
+	                                           new_radix_bits, data_layout.ColumnCount() - 1);
+	PartitionedTupleDataAppendState append_state;
+	partitioned_data.InitializeAppendState(append_state);
+	{
+		TupleDataChunkIterator iterator(data, TupleDataPinProperties::DESTROY_AFTER_DONE, true);
+		auto &chunk_state = iterator.GetChunkState();
+		do {
+			partitioned_data.Append(append_state, chunk_state, iterator.GetCurrentChunkCount());
+		} while (iterator.Next());
+	}
+	partitioned_data.FlushAppendState(append_state);
+	data.Reset();
+
+	// Unpin the partitions so they can be spilled while we combine them one at a time
+	partitioned_data.Unpin();
+	sink.spill_size += partitioned_data.SizeInBytes();
+	sink.finalize_repartitions++;
+
+	const auto total_count = partitioned_data.Count();
+	idx_t combined_count = 0;
+	for (auto &partition : partitioned_data.GetPartitions()) {
+		if (partition->Count() == 0) {
+			continue;
+		}
+		combined_count += partition->Count();
+		Combine(sink, *partition, new_radix_bits, memory_limit, result, nullptr);
+		partition->Reset();
+		if (progress) {
+			*progress = double(combined_count) / double(total_count);
+		}
+	}
+}
+
 void RadixHTLocalSourceState::Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate, DataChunk &chunk) {
 	D_ASSERT(task == RadixHTSourceTaskType::SCAN);
 	D_ASSERT(scan_status != RadixHTScanStatus::DONE);
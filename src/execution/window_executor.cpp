@@ -936,9 +936,14 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 }
 
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-                              WindowExecutorGlobalState &gstate) const {
+                              WindowExecutorGlobalState &gstate,
+                              optional_ptr<WindowExecutorLocalState> bounds_state) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
-	lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	if (bounds_state) {
+		lbstate.bounds.Reference(bounds_state->Cast<WindowExecutorBoundsState>().bounds);
+	} else {
+		lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	}
 
 	const auto count = input_chunk.size();
 	EvaluateInternal(gstate, lstate, result, count, row_idx);
@@ -946,6 +951,23 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 	result.Verify(count);
 }
 
+bool WindowExecutor::SharesBounds(const WindowExecutor &other) const {
+	//	Only aggregates: other functions evaluate more than the bounds when updating them
+	const auto &other_wexpr = other.wexpr;
+	if (wexpr.type != ExpressionType::WINDOW_AGGREGATE || other_wexpr.type != ExpressionType::WINDOW_AGGREGATE) {
+		return false;
+	}
+	if (wexpr.start != other_wexpr.start || wexpr.end != other_wexpr.end ||
+	    wexpr.exclude_clause != other_wexpr.exclude_clause) {
+		return false;
+	}
+	if (!Expression::Equals(wexpr.start_expr, other_wexpr.start_expr) ||
+	    !Expression::Equals(wexpr.end_expr, other_wexpr.end_expr)) {
+		return false;
+	}
+	return wexpr.KeysAreCompatible(other_wexpr);
+}
+
 WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context,
                                                  WindowAggregationMode mode)
     : WindowExecutor(wexpr, context), mode(mode) {
@@ -976,6 +998,10 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (mode == WindowAggregationMode::WINDOW &&
+	           WindowPrefixSumAggregator::CanAggregate(aggr, arg_types, return_type, wexpr.exclude_clause)) {
+		// invertible aggregates use the difference of two prefix sums
+		aggregator = make_uniq<WindowPrefixSumAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
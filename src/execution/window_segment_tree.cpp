@@ -316,6 +316,182 @@ void WindowConstantAggregator::Evaluate(const WindowAggregatorState &gsink, Wind
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// WindowPrefixSumAggregator
+//===--------------------------------------------------------------------===//
+static WindowPrefixSumAggregator::PrefixSumType GetPrefixSumType(const AggregateObject &aggr) {
+	const auto &name = aggr.function.name;
+	if (name == "sum") {
+		return WindowPrefixSumAggregator::PrefixSumType::SUM;
+	} else if (name == "avg") {
+		return WindowPrefixSumAggregator::PrefixSumType::AVERAGE;
+	} else {
+		return WindowPrefixSumAggregator::PrefixSumType::COUNT;
+	}
+}
+
+bool WindowPrefixSumAggregator::CanAggregate(const AggregateObject &aggr, const vector<LogicalType> &arg_types,
+                                             const LogicalType &result_type, const WindowExcludeMode exclude_mode) {
+	if (exclude_mode != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	const auto &name = aggr.function.name;
+	if (name == "count_star") {
+		return arg_types.empty() && result_type.id() == LogicalTypeId::BIGINT;
+	}
+	if (arg_types.size() != 1 || aggr.GetFunctionData()) {
+		return false;
+	}
+	if (name == "count") {
+		return result_type.id() == LogicalTypeId::BIGINT;
+	}
+	// 	Only exact sums: the prefix differences of floating point sums are not the sums of the frames
+	switch (arg_types[0].id()) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		break;
+	default:
+		return false;
+	}
+	if (name == "sum") {
+		return result_type.id() == LogicalTypeId::HUGEINT;
+	}
+	if (name == "avg") {
+		//	The regular average of a SMALLINT divides in double precision, the averages of wider integers are
+		//	finalized with more precision, so we leave those to the other aggregators to get the same results
+		return arg_types[0].id() == LogicalTypeId::SMALLINT && result_type.id() == LogicalTypeId::DOUBLE;
+	}
+	return false;
+}
+
+class WindowPrefixSumGlobalState : public WindowAggregatorState {
+public:
+	explicit WindowPrefixSumGlobalState(idx_t group_count) {
+		counts.reserve(group_count + 1);
+		counts.emplace_back(0);
+		sums.reserve(group_count + 1);
+		sums.emplace_back(0);
+	}
+
+	template <class T>
+	void SinkValues(DataChunk &payload_chunk, const bool *included);
+
+	//! The number of aggregated values before each row
+	vector<idx_t> counts;
+	//! The sum of the aggregated values before each row (if needed)
+	vector<hugeint_t> sums;
+};
+
+template <class T>
+void WindowPrefixSumGlobalState::SinkValues(DataChunk &payload_chunk, const bool *included) {
+	const auto count = payload_chunk.size();
+	UnifiedVectorFormat vdata;
+	payload_chunk.data[0].ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; ++i) {
+		const auto idx = vdata.sel->get_index(i);
+		if (included[i] && vdata.validity.RowIsValid(idx)) {
+			counts.emplace_back(counts.back() + 1);
+			sums.emplace_back(sums.back() + Hugeint::Convert(data[idx]));
+		} else {
+			counts.emplace_back(counts.back());
+			sums.emplace_back(sums.back());
+		}
+	}
+}
+
+WindowPrefixSumAggregator::WindowPrefixSumAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                                     const LogicalType &result_type,
+                                                     const WindowExcludeMode exclude_mode_p)
+    : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode_p),
+      prefix_type(GetPrefixSumType(this->aggr)) {
+}
+
+unique_ptr<WindowAggregatorState> WindowPrefixSumAggregator::GetGlobalState(idx_t group_count,
+                                                                            const ValidityMask &) const {
+	return make_uniq<WindowPrefixSumGlobalState>(group_count);
+}
+
+void WindowPrefixSumAggregator::Sink(WindowAggregatorState &gsink, DataChunk &payload_chunk,
+                                     SelectionVector *filter_sel, idx_t filtered) {
+	auto &gpsink = gsink.Cast<WindowPrefixSumGlobalState>();
+	const auto count = payload_chunk.size();
+
+	//	Find the rows that pass the FILTER
+	bool included[STANDARD_VECTOR_SIZE];
+	std::fill_n(included, count, filter_sel == nullptr);
+	for (idx_t f = 0; filter_sel && f < filtered; ++f) {
+		included[filter_sel->get_index(f)] = true;
+	}
+
+	if (arg_types.empty()) {
+		//	COUNT(*)
+		auto &counts = gpsink.counts;
+		for (idx_t i = 0; i < count; ++i) {
+			counts.emplace_back(counts.back() + included[i]);
+		}
+		return;
+	}
+
+	switch (payload_chunk.data[0].GetType().InternalType()) {
+	case PhysicalType::INT16:
+		gpsink.SinkValues<int16_t>(payload_chunk, included);
+		break;
+	case PhysicalType::INT32:
+		gpsink.SinkValues<int32_t>(payload_chunk, included);
+		break;
+	case PhysicalType::INT64:
+		gpsink.SinkValues<int64_t>(payload_chunk, included);
+		break;
+	default: {
+		//	COUNT(x) of any type: only the validity matters
+		auto &counts = gpsink.counts;
+		UnifiedVectorFormat vdata;
+		payload_chunk.data[0].ToUnifiedFormat(count, vdata);
+		for (idx_t i = 0; i < count; ++i) {
+			const auto idx = vdata.sel->get_index(i);
+			counts.emplace_back(counts.back() + (included[i] && vdata.validity.RowIsValid(idx)));
+		}
+		break;
+	}
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowPrefixSumAggregator::GetLocalState() const {
+	return make_uniq<WindowAggregatorState>();
+}
+
+void WindowPrefixSumAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                         const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	auto &gpsink = gsink.Cast<WindowPrefixSumGlobalState>();
+	const auto &counts = gpsink.counts;
+	const auto &sums = gpsink.sums;
+
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	for (idx_t i = 0; i < count; ++i) {
+		const auto begin = begins[i];
+		const auto end = MaxValue(begins[i], ends[i]);
+		const auto frame_count = counts[end] - counts[begin];
+		if (prefix_type == PrefixSumType::COUNT) {
+			FlatVector::GetData<int64_t>(result)[i] = UnsafeNumericCast<int64_t>(frame_count);
+			continue;
+		}
+		if (!frame_count) {
+			FlatVector::SetNull(result, i, true);
+			continue;
+		}
+		const auto sum = sums[end] - sums[begin];
+		if (prefix_type == PrefixSumType::SUM) {
+			FlatVector::GetData<hugeint_t>(result)[i] = sum;
+		} else {
+			//	Same computation as the average of a SMALLINT
+			FlatVector::GetData<double>(result)[i] = double(Hugeint::Cast<int64_t>(sum)) / double(frame_count);
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // WindowCustomAggregator
 //===--------------------------------------------------------------------===//
@@ -26,6 +26,7 @@ static const DefaultCompressionMethod internal_compression_methods[] = {
     {CompressionType::COMPRESSION_ALP, AlpCompressionFun::GetFunction, AlpCompressionFun::TypeIsSupported},
     {CompressionType::COMPRESSION_ALPRD, AlpRDCompressionFun::GetFunction, AlpRDCompressionFun::TypeIsSupported},
     {CompressionType::COMPRESSION_FSST, FSSTFun::GetFunction, FSSTFun::TypeIsSupported},
+    {CompressionType::COMPRESSION_ZSTD, ZSTDFun::GetFunction, ZSTDFun::TypeIsSupported},
     {CompressionType::COMPRESSION_AUTO, nullptr, nullptr}};
 
 static optional_ptr<CompressionFunction> FindCompressionFunction(CompressionFunctionSet &set, CompressionType type,
@@ -81,6 +82,7 @@ vector<reference<CompressionFunction>> DBConfig::GetCompressionFunctions(const C
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_ALP, info);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_ALPRD, info);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_FSST, info);
+	TryLoadCompression(*this, result, CompressionType::COMPRESSION_ZSTD, info);
 	return result;
 }
 
@@ -0,0 +1,56 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBPrefetchStatisticsData : public GlobalTableFunctionState {
+	DuckDBPrefetchStatisticsData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBPrefetchStatisticsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                             vector<LogicalType> &return_types,
+                                                             vector<string> &names) {
+	names.emplace_back("scheduled_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("prefetch_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("prefetch_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBPrefetchStatisticsInit(ClientContext &context,
+                                                                  TableFunctionInitInput &input) {
+	return make_uniq<DuckDBPrefetchStatisticsData>();
+}
+
+void DuckDBPrefetchStatisticsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBPrefetchStatisticsData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &statistics = BufferManager::GetBufferManager(context).GetPrefetchStatistics();
+	idx_t col = 0;
+	// scheduled_blocks, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.scheduled_blocks.load())));
+	// prefetch_hits, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.hits.load())));
+	// prefetch_misses, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.misses.load())));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBPrefetchStatisticsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_prefetch_statistics", {}, DuckDBPrefetchStatisticsFunction,
+	                              DuckDBPrefetchStatisticsBind, DuckDBPrefetchStatisticsInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,66 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryResultCacheData : public GlobalTableFunctionState {
+	DuckDBQueryResultCacheData() : offset(0) {
+	}
+
+	vector<QueryResultCacheEntryInfo> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryResultCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("result_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryResultCacheInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryResultCacheData>();
+
+	result->entries = DatabaseInstance::GetDatabase(context).GetQueryResultCache().GetEntries();
+	return std::move(result);
+}
+
+void DuckDBQueryResultCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryResultCacheData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// result_rows, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.result_rows)));
+		// memory_usage_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.memory_usage)));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.hits)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryResultCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_result_cache", {}, DuckDBQueryResultCacheFunction,
+	                              DuckDBQueryResultCacheBind, DuckDBQueryResultCacheInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferEvictionPolicy : uint8_t {
+	//! Evict the least recently used blocks first
+	LRU = 0,
+	//! Keep blocks that are referenced repeatedly in a separate queue, and evict blocks that were referenced only once
+	//! (e.g. by a large sequential scan) before them
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
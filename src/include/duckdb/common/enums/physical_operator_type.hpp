@@ -27,6 +27,7 @@ enum class PhysicalOperatorType : uint8_t {
 	UNGROUPED_AGGREGATE,
 	HASH_GROUP_BY,
 	PERFECT_HASH_GROUP_BY,
+	STREAMING_GROUP_BY,
 	FILTER,
 	PROJECTION,
 	COPY_TO_FILE,
@@ -62,6 +63,7 @@ enum class PhysicalOperatorType : uint8_t {
 	RIGHT_DELIM_JOIN,
 	POSITIONAL_JOIN,
 	ASOF_JOIN,
+	INDEX_JOIN,
 	// -----------------------------
 	// SetOps
 	// -----------------------------
@@ -0,0 +1,27 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/query_priority.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The priority class of the tasks of a query. Each class gets a share of the worker threads that is proportional to
+//! its weight, and tasks of a lower class are preempted when tasks of a higher class are waiting.
+enum class QueryPriority : uint8_t {
+	//! Background work, e.g. long-running batch queries
+	LOW = 0,
+	NORMAL = 1,
+	//! Interactive queries that should be answered with low latency, even while heavy queries are running
+	HIGH = 2
+};
+
+static constexpr const idx_t QUERY_PRIORITY_COUNT = 3;
+
+} // namespace duckdb
@@ -51,6 +51,20 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A single read of a batch of reads, see FileSystem::BatchRead
+struct FileReadRequest {
+	FileReadRequest(void *buffer, idx_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	//! The buffer to read into
+	void *buffer;
+	//! The number of bytes to read
+	idx_t nr_bytes;
+	//! The location in the file to read from
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -61,6 +75,7 @@ public:
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void BatchRead(const vector<FileReadRequest> &requests);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
@@ -121,6 +136,9 @@ public:
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	DUCKDB_API virtual int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes);
+	//! Read all of the requests from the file, failing if any of them could not be read completely. File systems can
+	//! override this to issue the reads concurrently, by default they are read one after the other.
+	DUCKDB_API virtual void BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests);
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/io_uring.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+//! IOUring submits batches of reads to the Linux io_uring interface, so that the device can serve them concurrently
+//! from a single thread. The rings are cached and shared between all threads.
+class IOUring {
+public:
+	//! The maximum number of reads that are in flight on a single ring
+	static constexpr const idx_t RING_DEPTH = 64;
+
+public:
+	//! Whether or not io_uring is supported by the platform and the kernel
+	static bool IsSupported();
+	//! Enables or disables the use of io_uring. A disabled io_uring behaves as if the kernel does not support it
+	//! (i.e., as if io_uring_setup fails), which allows testing the fallback.
+	static void SetEnabled(bool enabled);
+	//! Reads the requests from the file descriptor. The requests are updated to reflect the bytes that were read,
+	//! reads that failed or were short are left for the caller to complete with a regular (blocking) read.
+	//! Returns false if io_uring is not supported, nothing has been read in that case.
+	static bool BatchRead(int fd, vector<FileReadRequest> &requests);
+};
+
+} // namespace duckdb
@@ -29,6 +29,9 @@ public:
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	//! Read all of the requests from the file. On Linux the reads are submitted at once through io_uring (if the
+	//! kernel supports it), so that the device can serve them concurrently.
+	void BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) override;
 	//! Excise a range of the file. The file-system is free to deallocate this
 	//! range (sparse file support). Reads to the range will succeed but will return
 	//! undefined data.
@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! NUMA exposes the NUMA topology of the machine, i.e., which CPUs and memory belong to which node (socket).
+//! On platforms without NUMA support, the machine is treated as a single node.
+class NUMA {
+public:
+	//! The number of NUMA nodes of the machine (at least 1)
+	static idx_t NodeCount();
+	//! The node of the CPU that the calling thread is currently running on
+	static idx_t GetCurrentNode();
+	//! The node that the (already touched) memory at the given address is placed on, or INVALID_INDEX if unknown
+	static idx_t GetMemoryNode(const_data_ptr_t pointer);
+	//! Restricts the calling thread to the CPUs of the given node. Returns false if this is not possible.
+	static bool PinThreadToNode(idx_t node);
+};
+
+} // namespace duckdb
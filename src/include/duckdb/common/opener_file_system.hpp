@@ -41,6 +41,9 @@ public:
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return GetFileSystem().Read(handle, buffer, nr_bytes);
 	}
+	void BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) override {
+		GetFileSystem().BatchRead(handle, requests);
+	}
 
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return GetFileSystem().Write(handle, buffer, nr_bytes);
@@ -0,0 +1,19 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+//! Software prefetching of memory that is about to be accessed. This is only a hint: it has no effect on the result,
+//! and it does nothing on compilers that do not support it
+#if __GNUC__
+#define DUCKDB_PREFETCH_READ(ptr)  (__builtin_prefetch((ptr), 0))
+#define DUCKDB_PREFETCH_WRITE(ptr) (__builtin_prefetch((ptr), 1))
+#else
+#define DUCKDB_PREFETCH_READ(ptr)  ((void)(ptr))
+#define DUCKDB_PREFETCH_WRITE(ptr) ((void)(ptr))
+#endif
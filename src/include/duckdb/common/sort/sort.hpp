@@ -22,6 +22,10 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Strings that fit in this many bytes (including the NULL byte) are stored in the sorting key in full
+	static constexpr idx_t MAX_INLINED_STRING_SIZE = 32;
+	//! Of longer strings, we only store a prefix of this many bytes (including the NULL byte), and break ties
+	static constexpr idx_t STRING_PREFIX_SIZE = 12;
 };
 
 struct SortLayout {
@@ -94,6 +98,12 @@ public:
 	//! Progress in merge path stage
 	idx_t pair_idx;
 	idx_t num_pairs;
+	idx_t partition_idx;
+	//! The number of partitions (of at most block_capacity rows) of each pair
+	vector<idx_t> pair_partitions;
+	//! The number of partitions of each pair for which no slices have been created yet
+	vector<idx_t> unsliced_partitions;
+	//! The end of the last partition of the current pair (external sorts only)
 	idx_t l_start;
 	idx_t r_start;
 };
@@ -170,9 +180,24 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The pair and partition that this thread is merging
+	idx_t pair_idx;
+	idx_t partition_idx;
+	//! The boundaries of the partition in the left and right block
+	idx_t l_start;
+	idx_t r_start;
+	idx_t l_end;
+	idx_t r_end;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Claims the partition that will be merged next (Merge Path partition)
 	void GetNextPartition();
+	//! Finds the boundaries of the claimed partition
+	void ComputePartitionBoundaries();
+	//! Creates the slices of the left and right block that this thread must merge
+	void CreatePartitionSlices(bool reset_previous);
+	//! Releases the blocks of the pair once slices have been created for all of its partitions
+	void FinishPartitionSlices();
 	//! Finds the boundary of the next partition using binary search
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
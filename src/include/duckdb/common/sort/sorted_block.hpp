@@ -31,7 +31,9 @@ public:
 	//! Initialize new block to write to
 	void CreateBlock();
 	//! Create a slice that holds the rows between the start and end indices
-	unique_ptr<SortedData> CreateSlice(idx_t start_block_index, idx_t end_block_index, idx_t end_entry_index);
+	//! If reset_previous is true, the references to the blocks before the slice are reset
+	unique_ptr<SortedData> CreateSlice(idx_t start_block_index, idx_t end_block_index, idx_t end_entry_index,
+	                                   bool reset_previous);
 	//! Unswizzles all
 	void Unswizzle();
 
@@ -68,7 +70,8 @@ public:
 	//! given an index between 0 and the total number of rows in this block
 	void GlobalToLocalIndex(const idx_t &global_idx, idx_t &local_block_index, idx_t &local_entry_index);
 	//! Create a slice that holds the rows between the start and end indices
-	unique_ptr<SortedBlock> CreateSlice(const idx_t start, const idx_t end, idx_t &entry_idx);
+	//! If reset_previous is true, the references to the blocks before the slice are reset (not thread-safe)
+	unique_ptr<SortedBlock> CreateSlice(const idx_t start, const idx_t end, idx_t &entry_idx, bool reset_previous);
 
 	//! Size (in bytes) of the heap of this block
 	idx_t HeapSize() const;
@@ -26,6 +26,7 @@ public:
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	void BatchRead(FileHandle &handle, const vector<FileReadRequest> &requests) override;
 
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
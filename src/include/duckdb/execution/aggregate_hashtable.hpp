@@ -85,6 +85,10 @@ public:
 	void ClearPointerTable();
 	//! Resets the group count to 0
 	void ResetCount();
+	//! Skip the lookups in the pointer table: every row is appended as a new group, and duplicate groups are only
+	//! combined later on (used when the HT does not reduce the data)
+	void SetSkipLookups(bool skip_lookups_p);
+	bool SkipLookups() const;
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
@@ -128,6 +132,8 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether the lookups in the pointer table are skipped
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
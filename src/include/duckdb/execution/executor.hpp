@@ -65,6 +65,8 @@ public:
 
 	//! True if an error has been thrown
 	bool HasError();
+	//! True if the execution has been cancelled
+	bool IsCancelled();
 	//! Throw the exception that was pushed using PushError.
 	//! Should only be called if HasError returns true
 	void ThrowException();
@@ -107,7 +109,12 @@ public:
 		executor_tasks++;
 	}
 	void UnregisterTask() {
-		executor_tasks--;
+		// the count is decremented under the lock: once CancelTasks sees that no tasks are left, the executor can be
+		// destroyed, so we cannot touch it anymore after releasing the lock
+		lock_guard<mutex> l(executor_tasks_lock);
+		if (--executor_tasks == 0) {
+			executor_tasks_finished.notify_all();
+		}
 	}
 
 private:
@@ -174,5 +181,8 @@ private:
 
 	//! Currently alive executor tasks
 	atomic<idx_t> executor_tasks;
+	//! Signalled when the last executor task is destroyed, used by CancelTasks to wait for the tasks
+	mutex executor_tasks_lock;
+	std::condition_variable executor_tasks_finished;
 };
 } // namespace duckdb
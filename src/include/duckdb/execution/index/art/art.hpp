@@ -83,8 +83,10 @@ public:
 	//! Insert a chunk of entries into the index
 	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_identifiers) override;
 
-	//! Construct an ART from a vector of sorted keys
-	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
+	//! Construct an ART bottom-up from a vector of sorted keys and their row IDs
+	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, const row_t *row_ids);
+	//! Sort a vector of keys and their row IDs (if they are not sorted yet), and construct an ART from them
+	bool Construct(idx_t count, vector<ARTKey> &keys, vector<row_t> &row_ids);
 
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
@@ -118,6 +120,10 @@ public:
 
 	//! Find the node with a matching key, or return nullptr if not found
 	optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
+	//! Find the leaves of a batch of keys. The traversals of the keys are interleaved and the next node of each key
+	//! is prefetched, so that the cache misses of different keys overlap. Keys that are empty or not in the ART get
+	//! an empty leaf
+	void Lookup(const vector<ARTKey> &keys, idx_t count, vector<Node> &leaves);
 	//! Insert a key into the tree
 	bool Insert(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
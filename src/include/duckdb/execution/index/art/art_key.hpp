@@ -58,6 +58,7 @@ public:
 	const data_t &operator[](size_t i) const {
 		return data[i];
 	}
+	bool operator<(const ARTKey &k) const;
 	bool operator>(const ARTKey &k) const;
 	bool operator>=(const ARTKey &k) const;
 	bool operator==(const ARTKey &k) const;
@@ -0,0 +1,131 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/join_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! JoinBloomFilter is a split block Bloom filter over the hashes of the build-side keys of a JoinHashTable
+/*!
+    The filter consists of blocks of 8 32-bit words. Every key sets exactly one bit in each word of a single block,
+    so checking a key costs at most one cache miss. The block is selected by the upper 32 bits of the hash, the bits
+    within the block are derived from the lower 32 bits. The per-word loops have a fixed trip count and no branches,
+    so the compiler can vectorize them.
+*/
+class JoinBloomFilter {
+public:
+	//! The number of 32-bit words in a block
+	static constexpr const idx_t WORDS_PER_BLOCK = 8;
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOOM_BLOCK_SIZE = WORDS_PER_BLOCK * sizeof(uint32_t);
+	//! The number of bits in the filter per build-side key, this gives a false positive rate of ~0.5%
+	static constexpr const idx_t BITS_PER_KEY = 16;
+
+public:
+	JoinBloomFilter() : blocks(nullptr), block_mask(0) {
+	}
+
+	//! Allocates an empty filter that is large enough to hold "count" keys
+	void Initialize(Allocator &allocator, idx_t count) {
+		const auto block_count = NextPowerOfTwo(MaxValue<idx_t>(count * BITS_PER_KEY / (BLOOM_BLOCK_SIZE * 8), 1));
+		// over-allocate so that we can align the blocks to their size, a block then never crosses a cache line
+		data = allocator.Allocate(block_count * BLOOM_BLOCK_SIZE + BLOOM_BLOCK_SIZE);
+		auto aligned = AlignValue<uintptr_t, BLOOM_BLOCK_SIZE>(reinterpret_cast<uintptr_t>(data.get()));
+		blocks = reinterpret_cast<uint32_t *>(aligned);
+		block_mask = block_count - 1;
+		memset(blocks, 0, block_count * BLOOM_BLOCK_SIZE);
+	}
+
+	//! Releases the filter
+	void Reset() {
+		data.Reset();
+		blocks = nullptr;
+		block_mask = 0;
+	}
+
+	bool IsInitialized() const {
+		return blocks != nullptr;
+	}
+
+	//! Adds the hashes to the filter, "parallel" must be set if other threads insert at the same time
+	void Insert(const hash_t *hashes, idx_t count, bool parallel) {
+		D_ASSERT(IsInitialized());
+		uint32_t masks[WORDS_PER_BLOCK];
+		for (idx_t i = 0; i < count; i++) {
+			const auto hash = hashes[i];
+			ComputeMasks(hash, masks);
+			auto block = GetBlock(hash);
+			if (parallel) {
+				auto atomic_block = reinterpret_cast<atomic<uint32_t> *>(block);
+				for (idx_t w = 0; w < WORDS_PER_BLOCK; w++) {
+					atomic_block[w].fetch_or(masks[w], std::memory_order_relaxed);
+				}
+			} else {
+				for (idx_t w = 0; w < WORDS_PER_BLOCK; w++) {
+					block[w] |= masks[w];
+				}
+			}
+		}
+	}
+
+	//! Checks the hashes of the rows in "sel" against the filter, and writes the rows that may be in the filter
+	//! to "result_sel". Returns the number of rows that may be in the filter.
+	idx_t Filter(const UnifiedVectorFormat &hashes_format, const SelectionVector &sel, idx_t count,
+	             SelectionVector &result_sel) const {
+		D_ASSERT(IsInitialized());
+		const auto hashes = UnifiedVectorFormat::GetData<hash_t>(hashes_format);
+		uint32_t masks[WORDS_PER_BLOCK];
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			const auto row_index = sel.get_index(i);
+			const auto hash = hashes[hashes_format.sel->get_index(row_index)];
+			ComputeMasks(hash, masks);
+			const auto block = GetBlock(hash);
+			// a bit of the key that is not set in the block means that the key was never inserted
+			uint32_t missing = 0;
+			for (idx_t w = 0; w < WORDS_PER_BLOCK; w++) {
+				missing |= masks[w] & ~block[w];
+			}
+			result_sel.set_index(result_count, row_index);
+			result_count += missing == 0;
+		}
+		return result_count;
+	}
+
+private:
+	//! Computes the bit that the key sets in each of the words of its block
+	static inline void ComputeMasks(hash_t hash, uint32_t masks[]) {
+		// odd constants that spread the lower 32 bits of the hash over the words (taken from the Parquet spec)
+		static constexpr const uint32_t SALTS[WORDS_PER_BLOCK] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+		                                                          0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+		                                                          0x9efc4947U, 0x5c6bfb31U};
+		const auto key = static_cast<uint32_t>(hash);
+		for (idx_t w = 0; w < WORDS_PER_BLOCK; w++) {
+			masks[w] = 1U << ((key * SALTS[w]) >> 27);
+		}
+	}
+
+	inline uint32_t *GetBlock(hash_t hash) const {
+		return blocks + ((hash >> 32) & block_mask) * WORDS_PER_BLOCK;
+	}
+
+private:
+	//! The allocated memory of the filter
+	AllocatedData data;
+	//! The (aligned) blocks of the filter
+	uint32_t *blocks;
+	//! Bitmask for getting the block index from the upper 32 bits of the hash
+	idx_t block_mask;
+};
+
+} // namespace duckdb
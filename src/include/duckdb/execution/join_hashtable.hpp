@@ -17,6 +17,8 @@
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/join_bloom_filter.hpp"
+#include "duckdb/execution/join_heavy_hitters.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
@@ -64,6 +66,9 @@ public:
 	// only compare salts with the ht entries if the capacity is larger than 8192 so
 	// that it does not fit into the CPU cache
 	static constexpr const idx_t USE_SALT_THRESHOLD = 8192;
+	//! only build a Bloom filter if the HT has at least this many entries, otherwise the pointer table is small enough
+	//! to fit in the CPU cache and the Bloom filter does not save any cache misses
+	static constexpr const idx_t BLOOM_FILTER_THRESHOLD = 32768;
 
 	//! Scan structure that can be used to resume scans, as a single probe can
 	//! return 1024*N values (where N is the size of the HT). This is
@@ -146,6 +151,7 @@ public:
 		Vector ht_offsets_dense_v;
 
 		SelectionVector non_empty_sel;
+		SelectionVector bloom_filter_sel;
 	};
 
 	struct InsertState : SharedState {
@@ -252,6 +258,13 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Whether or not to build a Bloom filter that is checked before the pointer table while probing
+	bool use_bloom_filter;
+	//! The number of probe-side rows that were rejected by the Bloom filter
+	atomic<idx_t> bloom_filter_rejected;
+	//! Whether or not to keep track of the heavy hitters of the build side, which is only needed if the join can go
+	//! external (see SetRepartitionRadixBits)
+	bool track_heavy_hitters;
 
 	struct {
 		mutex mj_lock;
@@ -301,6 +314,10 @@ private:
 	//! The hash map of the HT, created after finalization
 	AllocatedData hash_map;
 	ht_entry_t *entries;
+	//! The Bloom filter over the hashes of the HT, created after finalization (if enabled)
+	JoinBloomFilter bloom_filter;
+	//! Sketch of the most frequent hashes of the build side, used for partitioning skewed build sides
+	JoinHeavyHitters heavy_hitters;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
 	//! An empty tuple that's a "dead end", can be used to stop chains early
@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/join_heavy_hitters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//! JoinHeavyHitters is a Space-Saving sketch over (a sample of) the hashes of the build-side keys of a JoinHashTable
+/*!
+    Every SAMPLE_RATE-th row is counted in one of CAPACITY counters. A hash that is not counted yet replaces the
+    counter with the lowest count, and inherits that count as its error. A key that makes up more than
+    1 / CAPACITY of the sampled rows is therefore always found, and the count minus the error is a lower bound of the
+    number of sampled rows with the hash. Sketches of different threads are combined by adding up their counters.
+*/
+class JoinHeavyHitters {
+public:
+	//! The number of counters of the sketch
+	static constexpr const idx_t CAPACITY = 16;
+	//! Only every SAMPLE_RATE-th row is counted, this keeps the overhead of the sketch on the build negligible
+	static constexpr const idx_t SAMPLE_RATE = 8;
+
+	struct HeavyHitter {
+		hash_t hash;
+		//! The (estimated) number of build-side rows with the hash
+		idx_t count;
+	};
+
+public:
+	JoinHeavyHitters() : counter_count(0), sample_offset(0) {
+	}
+
+	//! Adds the hashes of the rows in "sel" to the sketch
+	void Update(const UnifiedVectorFormat &hashes_format, const SelectionVector &sel, idx_t count) {
+		const auto hashes = UnifiedVectorFormat::GetData<hash_t>(hashes_format);
+		idx_t i = sample_offset;
+		for (; i < count; i += SAMPLE_RATE) {
+			Add(hashes[hashes_format.sel->get_index(sel.get_index(i))], 1, 0);
+		}
+		sample_offset = i - count;
+	}
+
+	//! Adds the counters of another sketch to this sketch
+	void Combine(const JoinHeavyHitters &other) {
+		for (idx_t i = 0; i < other.counter_count; i++) {
+			Add(other.counters[i].hash, other.counters[i].count, other.counters[i].error);
+		}
+	}
+
+	//! Returns the hashes that occur in an estimated "min_count" or more build-side rows
+	vector<HeavyHitter> GetHeavyHitters(idx_t min_count) const {
+		vector<HeavyHitter> result;
+		for (idx_t i = 0; i < counter_count; i++) {
+			const auto count = (counters[i].count - counters[i].error) * SAMPLE_RATE;
+			if (count >= min_count) {
+				result.push_back({counters[i].hash, count});
+			}
+		}
+		return result;
+	}
+
+private:
+	struct Counter {
+		hash_t hash;
+		idx_t count;
+		//! The count of the counter that this hash replaced, the hash may have occurred this many times less
+		idx_t error;
+	};
+
+	void Add(hash_t hash, idx_t count, idx_t error) {
+		for (idx_t i = 0; i < counter_count; i++) {
+			if (counters[i].hash == hash) {
+				counters[i].count += count;
+				counters[i].error += error;
+				return;
+			}
+		}
+		if (counter_count < CAPACITY) {
+			counters[counter_count++] = {hash, count, error};
+			return;
+		}
+		auto &min_counter = *std::min_element(counters, counters + CAPACITY,
+		                                      [](const Counter &a, const Counter &b) { return a.count < b.count; });
+		min_counter = {hash, min_counter.count + count, min_counter.count + error};
+	}
+
+private:
+	Counter counters[CAPACITY];
+	//! The number of counters in use
+	idx_t counter_count;
+	//! The number of rows to skip before the next sampled row
+	idx_t sample_offset;
+};
+
+} // namespace duckdb
@@ -13,12 +13,16 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause), and aggregates
+//! over bounded ROWS frames of input that is already ordered on the partitions and orders of the window
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
 
 	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr);
+	//! Whether the window is an aggregate over a ROWS frame that ends at (or before) the current row, which can be
+	//! streamed if the input is ordered on the partitions and orders of the window
+	static bool IsStreamingFrame(ClientContext &context, unique_ptr<Expression> &expr);
 
 public:
 	PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/join_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/joinside.hpp"
+
+namespace duckdb {
+class PhysicalOperator;
+
+struct JoinFilterPushdownColumn {
+	//! The join condition (i.e. the index in the join keys) this filter is derived from
+	idx_t join_condition;
+	//! The filter data that is shared with the probe-side table scan
+	shared_ptr<DynamicFilterData> filter_data;
+};
+
+struct JoinFilterColumnState {
+	//! The min/max of the (non-NULL) build-side keys
+	Value min;
+	Value max;
+	//! The build-side keys - only collected while the build side is small enough to push an IN-list
+	vector<Value> values;
+};
+
+struct JoinFilterGlobalState {
+	mutex lock;
+	//! The number of build-side rows
+	idx_t count = 0;
+	vector<JoinFilterColumnState> columns;
+};
+
+struct JoinFilterLocalState {
+	//! The number of build-side rows sunk by this thread
+	idx_t count = 0;
+	vector<JoinFilterColumnState> columns;
+};
+
+//! JoinFilterPushdownInfo derives runtime filters from the build side of a hash join and pushes them into the
+//! table scan on the probe side. Small build sides are pushed as an IN-list of the join keys, larger ones as the
+//! [min, max] range of the join keys. The scan uses the filters to skip row groups and segments based on their
+//! statistics, and to filter out rows that cannot find a join partner before they reach the join.
+class JoinFilterPushdownInfo {
+public:
+	//! The maximum number of build-side rows for which we push an IN-list instead of a [min, max] range
+	static constexpr const idx_t IN_LIST_THRESHOLD = 16;
+
+	//! The columns we push filters for
+	vector<JoinFilterPushdownColumn> columns;
+
+public:
+	//! Tries to find a table scan on the probe side of a hash join that the equality conditions can be pushed into.
+	//! Registers dynamic filters with the scan and returns the pushdown info, or nullptr if nothing can be pushed.
+	static unique_ptr<JoinFilterPushdownInfo> Create(const vector<JoinCondition> &conditions, JoinType join_type,
+	                                                 PhysicalOperator &probe_child);
+
+	//! Initializes the global state - this also clears any filters that were pushed by a previous execution
+	unique_ptr<JoinFilterGlobalState> GetGlobalState() const;
+	unique_ptr<JoinFilterLocalState> GetLocalState() const;
+
+	//! Updates the local state with a chunk of build-side join keys
+	void Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const;
+	//! Merges the local state into the global state
+	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
+	//! Creates the filters from the global state and makes them visible to the probe-side scan
+	void PushFilters(JoinFilterGlobalState &gstate) const;
+};
+
+} // namespace duckdb
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+class ART;
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an inner equi-join where one side is a base table with an ART index on the join key.
+//! Instead of building a hash table over that side, the index is probed with the keys of the other side, and the
+//! matching rows are fetched from the table.
+class PhysicalIndexJoin : public PhysicalComparisonJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe, unique_ptr<PhysicalOperator> table_scan,
+	                  vector<JoinCondition> cond, JoinType join_type, const vector<idx_t> &probe_projection_map,
+	                  const vector<idx_t> &table_projection_map, ART &index, bool probe_first,
+	                  idx_t estimated_cardinality);
+
+	//! The name of the index that is probed (the index is looked up again when the execution starts, because it may
+	//! have been dropped since the plan was created)
+	string index_name;
+	//! The storage id of the indexed column
+	column_t index_column;
+	//! The table the index belongs to
+	DuckTableEntry &table;
+	//! The types of the join keys
+	vector<LogicalType> condition_types;
+	//! Positions of the probe-side columns that need to be output
+	vector<idx_t> probe_output_columns;
+	//! The storage ids of the table columns that need to be output, followed by the row id
+	vector<column_t> fetch_ids;
+	//! The types of the fetched columns
+	vector<LogicalType> fetch_types;
+	//! Whether the probe-side columns come before the table columns in the output (i.e., the index is on the RHS)
+	bool probe_first;
+
+public:
+	string ParamsToString() const override;
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	// CachingOperator Interface
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	// Pipeline construction: the table side is never scanned, only the probe side is part of the pipeline
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+	vector<const_reference<PhysicalOperator>> GetSources() const override;
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,9 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter on the first ORDER BY column that is pushed into the table scan below (if any). It is updated with
+	//! the boundary of the top-n while sinking, so the scan can skip the rows and row groups that cannot make it in.
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
@@ -55,6 +59,9 @@ public:
 	}
 
 	string ParamsToString() const override;
+
+	//! Tries to push a dynamic filter on the first ORDER BY column into the table scan below the top-n
+	void PushDynamicFilter();
 };
 
 } // namespace duckdb
@@ -48,6 +48,11 @@ public:
 	vector<Value> parameters;
 
 public:
+	//! Follows a column of the operator down the plan until we reach the table scan that produces it. Returns the scan
+	//! if a dynamic filter on the column can be pushed into it (and sets column_index to the index of the column in the
+	//! scan), or nullptr otherwise.
+	static optional_ptr<PhysicalTableScan> FindDynamicFilterScan(PhysicalOperator &op, idx_t &column_index);
+
 	string GetName() const override;
 	string ParamsToString() const override;
 
@@ -27,7 +27,10 @@ public:
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
 	                       unique_ptr<CreateIndexInfo> info, vector<unique_ptr<Expression>> unbound_expressions,
-	                       idx_t estimated_cardinality, const bool sorted);
+	                       idx_t estimated_cardinality);
+
+	//! The number of keys that each thread buffers before it sorts them and constructs an ART from them
+	static constexpr const idx_t BULK_CONSTRUCT_THRESHOLD = 1048576;
 
 	//! The table to create the index for
 	DuckTableEntry &table;
@@ -37,8 +40,6 @@ public:
 	unique_ptr<CreateIndexInfo> info;
 	//! Unbound expressions to be used in the optimizer
 	vector<unique_ptr<Expression>> unbound_expressions;
-	//! Whether the pipeline sorts the data prior to index creation
-	const bool sorted;
 
 public:
 	//! Source interface, NOP for this operator
@@ -54,11 +55,6 @@ public:
 	//! Sink interface, global sink state
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
 
-	//! Sink for unsorted data: insert iteratively
-	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
-	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -46,6 +46,10 @@ public:
 	static bool PreserveInsertionOrder(ClientContext &context, PhysicalOperator &plan);
 
 	static bool HasEquality(vector<JoinCondition> &conds, idx_t &range_count);
+	//! Finds the ORDER BY that produces the (ordered) input of an operator, looking through the projections in between.
+	//! The columns of the input are replaced by the corresponding columns of the input of the ORDER BY. Returns nullptr
+	//! if there is no such ORDER BY, or if one of the columns is not a plain column reference.
+	static optional_ptr<LogicalOrder> FindOrderedInput(LogicalOperator &input, vector<idx_t> &columns);
 
 protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalOperator &op);
@@ -17,6 +17,20 @@ namespace duckdb {
 class GroupedAggregateHashTable;
 struct AggregatePartition;
 
+//! Statistics of the partitioned (and possibly out-of-core) aggregation, shown in the profiler
+struct RadixHTStatistics {
+	//! Size of the data that was unpinned so that it could be spilled to disk
+	idx_t spill_size = 0;
+	//! Number of partitions that were finalized
+	idx_t partition_count = 0;
+	//! Number of times that the data of a partition was repartitioned because it did not fit in memory
+	idx_t finalize_repartitions = 0;
+	//! Number of times that a scan had to wait for the finalize of a partition
+	idx_t finalize_waits = 0;
+	//! Number of rows that were sunk without looking up their group in the thread-local HT
+	idx_t skipped_lookups = 0;
+};
+
 class RadixPartitionedHashTable {
 public:
 	RadixPartitionedHashTable(GroupingSet &grouping_set, const GroupedAggregateData &op);
@@ -55,6 +69,8 @@ public:
 	const TupleDataLayout &GetLayout() const;
 	idx_t MaxThreads(GlobalSinkState &sink) const;
 	static void SetMultiScan(GlobalSinkState &sink);
+	//! Adds the statistics of the partitioned aggregation to the result
+	static void GetStatistics(GlobalSinkState &sink, RadixHTStatistics &result);
 
 private:
 	void SetGroupingValues();
@@ -181,8 +181,14 @@ public:
 	virtual void Finalize(WindowExecutorGlobalState &gstate) const {
 	}
 
+	//! Evaluates the function. If bounds_state is set, the frame bounds that were computed by another function with
+	//! the same frames (see SharesBounds) are reused.
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-	              WindowExecutorGlobalState &gstate) const;
+	              WindowExecutorGlobalState &gstate,
+	              optional_ptr<WindowExecutorLocalState> bounds_state = nullptr) const;
+
+	//! Whether this function can reuse the frame bounds of another function of the same window operator
+	bool SharesBounds(const WindowExecutor &other) const;
 
 	// The function
 	const BoundWindowExpression &wexpr;
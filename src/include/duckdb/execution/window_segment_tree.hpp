@@ -136,6 +136,33 @@ public:
 	WindowAggregationMode mode;
 };
 
+//! Computes invertible aggregates (COUNT, SUM of integers and AVG of SMALLINTs) as the difference of two prefix sums,
+//! so every frame is aggregated in constant time
+class WindowPrefixSumAggregator : public WindowAggregator {
+public:
+	enum class PrefixSumType : uint8_t { COUNT, SUM, AVERAGE };
+
+	//! Whether the aggregate can be computed from prefix sums
+	static bool CanAggregate(const AggregateObject &aggr, const vector<LogicalType> &arg_types,
+	                         const LogicalType &result_type, const WindowExcludeMode exclude_mode);
+
+	WindowPrefixSumAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
+	                          const LogicalType &result_type_p, const WindowExcludeMode exclude_mode_p);
+
+	//	Build
+	unique_ptr<WindowAggregatorState> GetGlobalState(idx_t group_count,
+	                                                 const ValidityMask &partition_mask) const override;
+	void Sink(WindowAggregatorState &gsink, DataChunk &arg_chunk, SelectionVector *filter_sel, idx_t filtered) override;
+
+	//	Evaluate
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+
+	//! The aggregate that is computed
+	const PrefixSumType prefix_type;
+};
+
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	WindowDistinctAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
@@ -63,4 +63,12 @@ struct FSSTFun {
 	static bool TypeIsSupported(const CompressionInfo &info);
 };
 
+struct ZSTDFun {
+	//! The serialization version from which on ZSTD is considered automatically, older versions cannot read it
+	static constexpr const idx_t MINIMUM_SERIALIZATION_VERSION = 2;
+
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const CompressionInfo &info);
+};
+
 } // namespace duckdb
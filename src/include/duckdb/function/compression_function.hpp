@@ -28,6 +28,8 @@ struct ColumnFetchState;
 struct ColumnScanState;
 struct PrefetchState;
 struct SegmentScanState;
+struct SelectionVector;
+class TableFilter;
 
 class CompressionInfo {
 public:
@@ -175,6 +177,15 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for reading an entire vector while evaluating a pushed-down table filter on the compressed
+//! data. "sel" holds the "sel_count" rows that passed the previous filters, and is narrowed down to the rows that pass
+//! "filter". The values of the rows that do not pass the filter do not have to be scanned into "result".
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
+//! Function prototype used for reading only the "sel_count" rows in "sel" of an entire vector of "vector_count" rows.
+//! The selected rows are written to the start of "result", and the scan state is moved forward by the entire vector.
+typedef void (*compression_select_t)(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                     Vector &result, const SelectionVector &sel, idx_t sel_count);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -216,9 +227,9 @@ public:
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
-	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
-	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      fetch_row(fetch_row), skip(skip), filter(nullptr), select(nullptr), init_segment(init_segment),
+	      init_append(init_append), append(append), finalize_append(finalize_append), revert_append(revert_append),
+	      serialize_state(serialize_state), deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
 	}
 
 	//! Compression type
@@ -262,6 +273,12 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Scan an entire vector and evaluate a filter directly on the compressed data (optional)
+	//! this is used instead of scan_vector for columns with a filter, if the vector does not cross segment boundaries
+	compression_filter_t filter;
+	//! Scan only the selected rows of an entire vector (optional)
+	//! this is used instead of scan_vector to fetch the columns without filters, if only part of the rows passed
+	compression_select_t select;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
@@ -97,6 +97,18 @@ struct DuckDBSequencesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBPrefetchStatisticsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBQueryMemoryFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBQueryResultCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSettingsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
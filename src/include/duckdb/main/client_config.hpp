@@ -12,6 +12,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/main/profiling_info.hpp"
@@ -85,6 +86,12 @@ struct ClientConfig {
 	bool force_fetch_row = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Force use of an index join whenever one of the sides of an equi-join has an index on the join key
+	bool force_index_join = false;
+	//! Push runtime filters derived from the build side of hash joins into the probe-side table scans
+	bool enable_join_filter_pushdown = true;
+	//! Push the boundary of top-n operators into the table scans below them
+	bool enable_top_n_filter_pushdown = true;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
@@ -95,6 +102,8 @@ struct ClientConfig {
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
 	//! The number of rows to accumulate before flushing during a partitioned write
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
+	//! The number of row groups ahead of a table scan that are loaded in the background
+	idx_t table_scan_prefetch_lookahead = 2;
 	//! The number of rows we need on either table to choose a nested loop join
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
@@ -102,6 +111,12 @@ struct ClientConfig {
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! The maximum memory that the operators of a query can reserve (default: no limit)
+	idx_t query_memory_limit = DConstants::INVALID_INDEX;
+	//! The priority class of the tasks of the queries of this connection
+	QueryPriority query_priority = QueryPriority::NORMAL;
+	//! Whether or not the results of queries are cached in (and served from) the query result cache of the database
+	bool enable_query_result_cache = false;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
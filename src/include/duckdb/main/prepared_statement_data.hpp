@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct QueryResultCacheKey;
 
 class PreparedStatementData {
 public:
@@ -48,6 +49,8 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The key of the result in the query result cache (nullptr if the result cannot be cached)
+	unique_ptr<QueryResultCacheKey> result_cache_key;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
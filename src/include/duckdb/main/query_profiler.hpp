@@ -128,6 +128,9 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Refreshes the extra info of all operators, which can contain information gathered during execution. Should only
+	//! be called once the operators have finished executing.
+	DUCKDB_API void RefreshExtraInfo();
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+struct DataTableInfo;
+
+//! The key of a cached query result: the serialized optimized plan, and the tables that the plan reads
+struct QueryResultCacheKey {
+	//! The serialized plan, followed by the values of the extension settings
+	string plan;
+	//! The tables that are read by the plan
+	vector<weak_ptr<DataTableInfo>> tables;
+};
+
+//! Information about an entry of the query result cache
+struct QueryResultCacheEntryInfo {
+	idx_t result_rows;
+	idx_t memory_usage;
+	idx_t hits;
+};
+
+//! The QueryResultCache holds the results of (deterministic, read-only) queries across connections. A cached result is
+//! only used while none of the tables that the query reads has committed a change since the result was computed.
+class QueryResultCache {
+public:
+	explicit QueryResultCache(idx_t memory_limit);
+
+	//! Creates the key of an optimized plan, returns nullptr if the result of the plan cannot be cached (e.g. because
+	//! it calls volatile functions, or reads from something other than DuckDB tables)
+	static unique_ptr<QueryResultCacheKey> CreateKey(ClientContext &context, LogicalOperator &plan);
+	//! Whether or not the result cache is enabled for the connection
+	static bool IsEnabled(ClientContext &context);
+
+	//! Returns a copy of the cached result of the key, or nullptr if there is no valid cached result
+	unique_ptr<ColumnDataCollection> Lookup(ClientContext &context, const QueryResultCacheKey &key);
+	//! Adds the result of the key to the cache, if it fits in the memory limit
+	void Insert(ClientContext &context, const QueryResultCacheKey &key, const ColumnDataCollection &result);
+
+	void SetMemoryLimit(idx_t limit);
+	void Clear();
+	vector<QueryResultCacheEntryInfo> GetEntries();
+
+private:
+	struct CacheEntry {
+		vector<weak_ptr<DataTableInfo>> tables;
+		//! The last commit id of each table when the result was computed
+		vector<transaction_t> versions;
+		unique_ptr<ColumnDataCollection> result;
+		idx_t memory_usage;
+		idx_t hits;
+		//! Used to evict the least recently used entry first
+		idx_t last_used;
+	};
+
+	//! Gets the versions of the tables of the key, returns false if the transaction of the context cannot use or fill
+	//! the cache for these tables (e.g. because it does not see the latest committed changes)
+	static bool GetTableVersions(ClientContext &context, const vector<weak_ptr<DataTableInfo>> &tables,
+	                             vector<transaction_t> &versions);
+	//! Whether one of the tables of the entry has changed (or was dropped) since the result was computed
+	static bool IsStale(const CacheEntry &entry);
+	//! Evicts entries until the memory usage is at most the given size
+	void EvictEntries(idx_t target_size);
+
+private:
+	mutex lock;
+	unordered_map<string, CacheEntry> entries;
+	idx_t memory_limit;
+	idx_t memory_usage;
+	idx_t use_counter;
+};
+
+} // namespace duckdb
@@ -130,6 +130,36 @@ struct PreferRangeJoins {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ForceIndexJoin {
+	static constexpr const char *Name = "force_index_join"; // NOLINT
+	static constexpr const char *Description =              // NOLINT
+	    "Force use of an index join whenever one of the sides of an equi-join has an index on the join key";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableJoinFilterPushdown {
+	static constexpr const char *Name = "enable_join_filter_pushdown"; // NOLINT
+	static constexpr const char *Description =                         // NOLINT
+	    "Push runtime filters derived from the build side of hash joins into the probe-side table scans";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableTopNFilterPushdown {
+	static constexpr const char *Name = "enable_top_n_filter_pushdown"; // NOLINT
+	static constexpr const char *Description =                          // NOLINT
+	    "Push the current boundary of ORDER BY ... LIMIT queries into the table scans as a runtime filter";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugWindowMode {
 	static constexpr const char *Name = "debug_window_mode";
 	static constexpr const char *Description = "DEBUG SETTING: switch window mode to use";
@@ -377,6 +407,16 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableQueryResultCacheSetting {
+	static constexpr const char *Name = "enable_query_result_cache";
+	static constexpr const char *Description =
+	    "Cache the results of read-only queries, and reuse them while the tables that they read do not change";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ErrorsAsJsonSetting {
 	static constexpr const char *Name = "errors_as_json";
 	static constexpr const char *Description = "Output error messages as structured JSON instead of as a raw string";
@@ -518,6 +558,56 @@ struct MaximumMemorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to evict persistent blocks from the buffer pool (LRU or 2Q). 2Q protects blocks that are "
+	    "referenced repeatedly from being evicted by large scans";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ConnectionMemoryLimitSetting {
+	static constexpr const char *Name = "connection_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory that the operators of a query of each connection can use before spilling (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory that the operators of a query can use before spilling (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The priority with which the tasks of the queries of this connection are scheduled (LOW, NORMAL or HIGH)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryResultCacheMemoryLimitSetting {
+	static constexpr const char *Name = "query_result_cache_memory_limit";
+	static constexpr const char *Description = "The maximum memory used by the query result cache (e.g. 64MB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StreamingBufferSize {
 	static constexpr const char *Name = "streaming_buffer_size";
 	static constexpr const char *Description =
@@ -744,6 +834,16 @@ struct SecretDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TableScanPrefetchLookaheadSetting {
+	static constexpr const char *Name = "table_scan_prefetch_lookahead";
+	static constexpr const char *Description =
+	    "The number of row groups ahead of a table scan that are loaded in the background (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
 	static constexpr const char *Description = "Set the directory to which to write temp files";
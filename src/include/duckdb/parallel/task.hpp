@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -16,6 +17,7 @@ class Executor;
 class Task;
 class DatabaseInstance;
 struct ProducerToken;
+struct WorkerQueue;
 
 enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
@@ -50,6 +52,11 @@ public:
 	virtual bool TaskBlockedOnResult() const {
 		return false;
 	}
+
+public:
+	//! The local queue of the worker thread that was executing this task when it was blocked (if any), the task is
+	//! rescheduled on this queue so that it continues where its data is likely still cached
+	optional_ptr<WorkerQueue> blocked_worker;
 };
 
 } // namespace duckdb
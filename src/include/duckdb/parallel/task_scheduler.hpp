@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
@@ -25,12 +26,18 @@ class TaskScheduler;
 struct SchedulerThread;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, QueryPriority priority,
+	              bool preemptible);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The priority class of the tasks of this producer
+	const QueryPriority priority;
+	//! Whether the tasks of this producer can be executed in PROCESS_PARTIAL mode, so that the worker threads can
+	//! preempt them in favor of tasks of a higher priority class
+	const bool preemptible;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
@@ -45,7 +52,10 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
+	//! Creates a producer for tasks that are always executed in PROCESS_ALL mode
 	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer for the tasks of a query with the given priority, these tasks can be preempted
+	unique_ptr<ProducerToken> CreateProducer(QueryPriority priority);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
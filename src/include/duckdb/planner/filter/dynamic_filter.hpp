@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+
+namespace duckdb {
+
+//! The shared state of a dynamic filter. The filter is set by the operator that produces it (e.g. a hash join build
+//! or a top-n) and read by the table scan that the filter was pushed into.
+class DynamicFilterData {
+public:
+	//! Set the filter - this makes the filter visible to all scans that share this data. The filter can be set multiple
+	//! times (e.g. whenever the boundary of a top-n improves), every new filter replaces the previous one.
+	void SetFilter(unique_ptr<TableFilter> filter);
+	//! Clear the filter
+	void Reset();
+	//! Returns the filter if it has been set, or nullptr otherwise. The filter stays alive for as long as the caller
+	//! holds on to it, even if it is replaced in the meantime.
+	shared_ptr<TableFilter> GetFilter() const;
+
+private:
+	mutable mutex lock;
+	//! The current filter
+	shared_ptr<TableFilter> filter;
+};
+
+//! A DynamicFilter is a placeholder for a filter that is only known at runtime. Until the filter is set, it accepts
+//! every row and never prunes any segment.
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter data (if any)
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	//! Whether or not dynamic filters can be created for columns of the type. The producer of the filter orders values
+	//! with the regular comparison operators, which must agree with the table filters and the segment statistics.
+	static bool SupportsType(const LogicalType &type);
+
+	//! Returns the filter if it has been set, or nullptr otherwise
+	shared_ptr<TableFilter> GetFilter() const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
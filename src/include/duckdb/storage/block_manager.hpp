@@ -22,6 +22,22 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A run of consecutive blocks that is read into a single buffer, see BlockManager::BatchReadBlocks
+struct BlockRun {
+	BlockRun(block_id_t start_block, idx_t block_count) : start_block(start_block), block_count(block_count) {
+	}
+	BlockRun(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(&buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	//! The buffer that holds the data of all blocks of the run
+	optional_ptr<FileBuffer> buffer;
+	//! The first block of the run
+	block_id_t start_block;
+	//! The number of blocks in the run
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -56,6 +72,8 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read the content of multiple runs of blocks from disk, the runs can be read concurrently
+	virtual void BatchReadBlocks(vector<BlockRun> &runs);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -104,6 +104,10 @@ public:
 	bool IsUnloaded() {
 		return state == BlockState::BLOCK_UNLOADED;
 	}
+	//! Whether the block was loaded by a prefetch (and has not been evicted since), clears the flag
+	bool ConsumePrefetched() {
+		return prefetched.exchange(false);
+	}
 
 private:
 	static BufferHandle Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileBuffer> buffer = nullptr);
@@ -129,6 +133,13 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! The eviction queue that holds the latest eviction node of this block
+	idx_t eviction_queue_idx;
+	//! The value of the buffer pool's reference clock when the block was unpinned at the start of its latest burst of
+	//! correlated references (for the 2Q eviction policy)
+	idx_t last_reference;
+	//! Whether or not the block was loaded by a prefetch, see ConsumePrefetched
+	atomic<bool> prefetched {false};
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
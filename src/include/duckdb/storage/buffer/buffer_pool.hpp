@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -31,12 +32,22 @@ struct BufferEvictionNode {
 
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
+//! Under the 2Q eviction policy, persistent blocks that have been referenced only once recently are kept in a separate
+//! queue that is evicted from first, so that large (sequential) scans cannot flush the frequently referenced blocks.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
 	friend class BufferManager;
 	friend class StandardBufferManager;
 
+public:
+	//! The index of the eviction queue that holds the persistent blocks that have been referenced only once recently
+	static constexpr const idx_t RECENT_BLOCK_QUEUE = FILE_BUFFER_TYPE_COUNT;
+	//! References of a block that follow the first reference of a burst within CORRELATED_REFERENCE_WINDOW references
+	//! to any block are considered to be correlated (e.g. a scan pinning the block again for the next segment in it),
+	//! and do not mark the block as frequently referenced. Only a reuse after this window does.
+	static constexpr const idx_t CORRELATED_REFERENCE_WINDOW = 8;
+
 public:
 	explicit BufferPool(idx_t maximum_memory, bool track_eviction_timestamps);
 	virtual ~BufferPool();
@@ -55,6 +66,13 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy that decides which persistent blocks are evicted first
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! Gets the index of the (default) eviction queue for the specified type
+	static idx_t GetEvictionQueueIndex(FileBufferType type);
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -81,8 +99,10 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Selects the eviction queue that a block is added to when it is unpinned. The block handle must be locked.
+	idx_t SelectEvictionQueue(BlockHandle &handle);
+	//! Increments the dead nodes for the queue that holds the latest eviction node of the block
+	void IncrementDeadNodes(BlockHandle &handle);
 
 protected:
 	//! The lock for changing the memory limit
@@ -93,7 +113,11 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! The policy that decides which persistent blocks are evicted first
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Counts the unpins of persistent blocks, used to measure the distance between two references of a block
+	atomic<idx_t> block_reference_clock;
+	//! Eviction queues, one per FileBufferType, followed by the queue of recently referenced persistent blocks
 	vector<unique_ptr<EvictionQueue>> queues;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
@@ -9,6 +9,8 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	idx_t buffer_hits;
+	idx_t buffer_misses;
 };
 
 struct TemporaryFileInformation {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -22,6 +23,19 @@ class Allocator;
 class BufferPool;
 class TemporaryMemoryManager;
 
+//! Counters of the blocks that are prefetched ahead of table scans
+struct PrefetchStatistics {
+	PrefetchStatistics() : scheduled_blocks(0), hits(0), misses(0) {
+	}
+
+	//! The number of blocks that were scheduled to be loaded in the background
+	atomic<idx_t> scheduled_blocks;
+	//! The number of blocks that were loaded by the prefetch by the time the scan reached them
+	atomic<idx_t> hits;
+	//! The number of prefetched blocks that the scan had to load itself
+	atomic<idx_t> misses;
+};
+
 class BufferManager {
 	friend class BufferHandle;
 	friend class BlockHandle;
@@ -93,6 +107,10 @@ public:
 
 	//! Get the manager that assigns reservations for temporary memory, e.g., for query intermediates
 	virtual TemporaryMemoryManager &GetTemporaryMemoryManager();
+	//! Get the counters of the blocks that are prefetched ahead of table scans
+	PrefetchStatistics &GetPrefetchStatistics() {
+		return prefetch_statistics;
+	}
 
 protected:
 	virtual void PurgeQueue(FileBufferType type) = 0;
@@ -100,6 +118,9 @@ protected:
 	virtual void WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer);
 	virtual unique_ptr<FileBuffer> ReadTemporaryBuffer(MemoryTag tag, block_id_t id, unique_ptr<FileBuffer> buffer);
 	virtual void DeleteTemporaryFile(block_id_t id);
+
+protected:
+	PrefetchStatistics prefetch_statistics;
 };
 
 } // namespace duckdb
@@ -114,6 +114,8 @@ protected:
 
 	//! Garbage collect eviction queue
 	void PurgeQueue(FileBufferType type) final;
+	//! Counts a pin of a block that was still loaded. The block handle must be locked.
+	void RecordBufferHit(BlockHandle &handle);
 
 	BufferPool &GetBufferPool() const final;
 	TemporaryMemoryManager &GetTemporaryMemoryManager() final;
@@ -144,7 +146,10 @@ protected:
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
 
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-	               block_id_t first_block, block_id_t last_block);
+	               const vector<BlockRun> &runs);
+	//! Loads the blocks of runs that have been read into intermediate buffers
+	void LoadBlocks(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	                vector<BlockRun> &buffer_runs);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
@@ -175,6 +180,9 @@ protected:
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
 	atomic<idx_t> evicted_data_per_tag[MEMORY_TAG_COUNT];
+	//! Pins of blocks that were still loaded (hits) or had to be loaded (misses) per tag
+	atomic<idx_t> buffer_hits_per_tag[MEMORY_TAG_COUNT];
+	atomic<idx_t> buffer_misses_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
@@ -85,11 +85,21 @@ public:
 	const LogicalType &RootType() const;
 	//! Whether or not the column has any updates
 	bool HasUpdates() const;
+	//! The version of the blocks of the segments, scans of a segment have to be re-initialized when this changes
+	idx_t GetVersion() const {
+		return version;
+	}
+	//! Signal that the blocks of (some of) the segments changed, e.g., because they were written to disk
+	void IncrementVersion() {
+		version++;
+	}
 	//! Whether or not we can scan an entire vector
 	virtual ScanVectorType GetVectorScanType(ColumnScanState &state, idx_t scan_count);
 
 	//! Initialize prefetch state with required I/O data for the next N rows
 	virtual void InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows);
+	//! Initialize prefetch state with the I/O data of all segments of the column
+	virtual void InitializeColumnPrefetch(PrefetchState &prefetch_state);
 	//! Initialize a scan of the column
 	virtual void InitializeScan(ColumnScanState &state);
 	//! Initialize a scan starting at the specified offset
@@ -112,6 +122,11 @@ public:
 	                        SelectionVector &sel, idx_t count);
 	virtual void FilterScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
 	                                 idx_t count, bool allow_updates);
+	//! Whether or not the next vector is read from a single segment that can scan only the selected rows of a vector
+	bool CanSelectVector(ColumnScanState &state, idx_t target_count);
+	//! Scans only the "sel_count" rows in "sel" of the next vector into the start of the result (see CanSelectVector)
+	void SelectVector(ColumnScanState &state, Vector &result, idx_t target_count, const SelectionVector &sel,
+	                  idx_t sel_count);
 
 	//! Skip the scan forward by "count" rows
 	virtual void Skip(ColumnScanState &state, idx_t count = STANDARD_VECTOR_SIZE);
@@ -171,8 +186,14 @@ protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
 
+	//! Prepares the scan state of the current segment for scanning the next vector
+	void BeginScanVector(ColumnScanState &state);
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type);
+	//! Scans an entire base vector from the current segment, and evaluates the filter on the compressed data of the
+	//! segment. Only rows for which the filter holds are kept in "sel".
+	void ScanVectorFiltered(ColumnScanState &state, Vector &result, idx_t scan_count, SelectionVector &sel,
+	                        idx_t &sel_count, const TableFilter &filter);
 	//! Scans a vector from the column merged with any potential updates
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -201,6 +222,8 @@ protected:
 	unique_ptr<SegmentStatistics> stats;
 	//! Total transient allocation size
 	idx_t allocation_size;
+	//! The version of the blocks of the segments
+	atomic<idx_t> version;
 };
 
 } // namespace duckdb
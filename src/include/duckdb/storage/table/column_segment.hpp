@@ -65,12 +65,21 @@ public:
 	                                                        const idx_t segment_size = Storage::BLOCK_SIZE);
 
 public:
-	void InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state);
+	void InitializePrefetch(PrefetchState &prefetch_state);
 	void InitializeScan(ColumnScanState &state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, ScanVectorType scan_type);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
+	//! Whether or not the filter can be evaluated on the compressed data of this segment
+	bool CanFilter(const TableFilter &filter) const;
+	//! Scan one entire vector from this segment, and evaluate the filter on the compressed data (see CanFilter)
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel, idx_t &sel_count,
+	            const TableFilter &filter);
+	//! Whether or not only the selected rows of a vector can be read from this segment
+	bool CanSelect() const;
+	//! Scan only the selected rows of one entire vector from this segment (see CanSelect)
+	void Select(ColumnScanState &state, idx_t scan_count, Vector &result, const SelectionVector &sel, idx_t sel_count);
 
 	static idx_t FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
 	                             const TableFilter &filter, idx_t scan_count, idx_t &approved_tuple_count);
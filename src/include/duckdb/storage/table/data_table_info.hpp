@@ -49,6 +49,15 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! The commit id of the last transaction that changed the data of the table (0 if it was not changed since the
+	//! database was opened)
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	void SetLastCommitId(transaction_t commit_id) {
+		last_commit_id = commit_id;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +75,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that changed the data of the table
+	atomic<transaction_t> last_commit_id;
 };
 
 } // namespace duckdb
@@ -42,6 +42,7 @@ class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
 class MetadataManager;
+struct PrefetchState;
 class RowVersionManager;
 
 struct RowGroupWriteInfo {
@@ -100,6 +101,8 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Initialize prefetch state with the I/O data of the columns that the scan reads from this row group
+	void InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(TableFilterSet &filters, const vector<column_t> &column_ids);
@@ -127,6 +127,11 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Loads the blocks of the row groups [begin, end) in the background
+	void PrefetchRowGroups(ClientContext &context, ParallelCollectionScanState &state, CollectionScanState &scan_state,
+	                       idx_t begin, idx_t end);
+	//! Records whether the prefetched blocks of a row group were loaded by the time the scan reached the row group
+	void RecordPrefetchResult(const vector<shared_ptr<BlockHandle>> &blocks);
 
 private:
 	//! BlockManager
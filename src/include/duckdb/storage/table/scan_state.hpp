@@ -83,6 +83,8 @@ struct ColumnScanState {
 	vector<ColumnScanState> child_states;
 	//! Whether or not InitializeState has been called for this segment
 	bool initialized = false;
+	//! The version of the column data when InitializeState was called for this segment
+	idx_t version = 0;
 	//! If this segment has already been checked for skipping purposes
 	bool segment_checked = false;
 	//! We initialize one SegmentScanState per segment, however, if scanning a DataChunk requires us to scan over more
@@ -106,6 +108,9 @@ struct ColumnFetchState {
 	buffer_handle_set_t handles;
 	//! Any child states of the fetch
 	vector<unique_ptr<ColumnFetchState>> child_states;
+	//! The scan states of the segments that rows were fetched from. Compression methods that decode more than the
+	//! fetched row keep them here, so that repeated fetches from the same segment can reuse them.
+	unordered_map<const ColumnSegment *, unique_ptr<SegmentScanState>> segment_states;
 
 	BufferHandle &GetOrInsertHandle(ColumnSegment &segment);
 };
@@ -189,6 +194,14 @@ struct ParallelCollectionScanState {
 	idx_t max_row;
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
+	//! The collection that the prefetch index refers to
+	RowGroupCollection *prefetch_collection;
+	//! The index of the first row group of the prefetch collection that has not been prefetched (or handed out to a
+	//! scan) yet
+	idx_t prefetch_index;
+	//! The blocks that were scheduled for prefetching, by row group index. The set of blocks is determined (e.g., by
+	//! the zonemaps) when the prefetch is issued, the scan of the row group checks which of them have been loaded.
+	map<idx_t, vector<shared_ptr<BlockHandle>>> prefetched_blocks;
 	mutex lock;
 };
 
@@ -18,13 +18,28 @@ namespace duckdb {
 class ClientContext;
 class TemporaryMemoryManager;
 
+//! The temporary memory of the active query of a connection
+struct QueryTemporaryMemory {
+	//! The query
+	string query;
+	//! The memory quota of the query
+	idx_t memory_limit = DConstants::INVALID_INDEX;
+	//! The number of active states of the query
+	idx_t state_count = 0;
+	//! The sum of reservations of the active states of the query
+	idx_t reservation = 0;
+	//! The sum of the remaining size of the active states of the query
+	idx_t remaining_size = 0;
+};
+
 //! State of the temporary memory to be managed concurrently with other states
 //! As long as this is within scope, it is active
 class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, QueryTemporaryMemory &query_memory,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -42,6 +57,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The temporary memory of the query that this state belongs to
+	QueryTemporaryMemory &query_memory;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -52,7 +69,9 @@ private:
 };
 
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
-//! to concurrent states, such that their combined memory usage does not exceed the limit
+//! to concurrent states, such that their combined memory usage does not exceed the limit.
+//! The combined reservation of the states of a single query is also limited by the memory quota of its connection,
+//! so that a single query cannot take the memory away from the queries of other connections.
 class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
@@ -80,6 +99,10 @@ public:
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Get the memory quota for the states of a single query of this connection
+	static idx_t GetQueryMemoryLimit(ClientContext &context);
+	//! Get the temporary memory of all queries that currently have active states
+	vector<QueryTemporaryMemory> GetQueryTemporaryMemory();
 
 private:
 	//! Locks the TemporaryMemoryManager
@@ -112,6 +135,8 @@ private:
 
 	//! Currently active states
 	reference_set_t<TemporaryMemoryState> active_states;
+	//! The temporary memory of the queries that have active states, per connection
+	reference_map_t<ClientContext, QueryTemporaryMemory> active_queries;
 	//! The sum of reservations of all active states
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
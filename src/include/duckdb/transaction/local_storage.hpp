@@ -113,6 +113,8 @@ public:
 	void InitializeScan(DataTable &table, CollectionScanState &state, optional_ptr<TableFilterSet> table_filters);
 	//! Scan
 	void Scan(CollectionScanState &state, const vector<storage_t> &column_ids, DataChunk &result);
+	//! Scan all transaction-local rows of a table, calling the callback for every chunk
+	bool Scan(DataTable &table, const vector<column_t> &column_ids, const std::function<bool(DataChunk &chunk)> &fun);
 
 	void InitializeParallelScan(DataTable &table, ParallelCollectionScanState &state);
 	bool NextParallelScan(ClientContext &context, DataTable &table, ParallelCollectionScanState &state,
@@ -11,6 +11,7 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -21,6 +22,7 @@
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
@@ -288,6 +290,12 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (prepared.result_cache_key && result->type == QueryResultType::MATERIALIZED_RESULT && !result->HasError() &&
+	    QueryResultCache::IsEnabled(*this)) {
+		// add the result to the cache before the transaction is committed
+		auto &collection = result->Cast<MaterializedQueryResult>().Collection();
+		db->GetQueryResultCache().Insert(*this, *prepared.result_cache_key, collection);
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -353,6 +361,10 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 		plan->Verify(*this);
 #endif
 	}
+	if (statement_type == StatementType::SELECT_STATEMENT && result->value_map.empty() &&
+	    QueryResultCache::IsEnabled(*this)) {
+		result->result_cache_key = QueryResultCache::CreateKey(*this, *plan);
+	}
 
 	profiler.StartPhase("physical_planner");
 	// now convert logical query plan into a physical query plan
@@ -469,10 +481,27 @@ unique_ptr<PendingQueryResult>
 ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
                                                 const PendingQueryParameters &parameters) {
 	D_ASSERT(active_query);
+	BindPreparedStatementParameters(*statement_p, parameters);
+
+	auto stream_result = parameters.allow_stream_result && statement_p->properties.allow_stream_result;
+	if (statement_p->result_cache_key && !stream_result && QueryResultCache::IsEnabled(*this)) {
+		auto &prepared = *statement_p;
+		auto cached_result = db->GetQueryResultCache().Lookup(*this, *prepared.result_cache_key);
+		if (cached_result) {
+			// the result is cached: scan the cached result instead of executing the plan
+			auto cached_statement = make_shared_ptr<PreparedStatementData>(prepared.statement_type);
+			cached_statement->names = prepared.names;
+			cached_statement->types = prepared.types;
+			cached_statement->properties = prepared.properties;
+			cached_statement->catalog_version = prepared.catalog_version;
+			auto count = cached_result->Count();
+			cached_statement->plan = make_uniq<PhysicalColumnDataScan>(
+			    prepared.types, PhysicalOperatorType::COLUMN_DATA_SCAN, count, std::move(cached_result));
+			statement_p = std::move(cached_statement);
+		}
+	}
 	auto &statement = *statement_p;
 
-	BindPreparedStatementParameters(statement, parameters);
-
 	active_query->executor = make_uniq<Executor>(*this);
 	auto &executor = *active_query->executor;
 	if (config.enable_progress_bar) {
@@ -487,8 +516,6 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 		active_query->progress_bar->Start();
 		query_progress.Restart();
 	}
-	auto stream_result = parameters.allow_stream_result && statement.properties.allow_stream_result;
-
 	get_result_collector_t get_method = PhysicalResultCollector::GetResultCollector;
 	auto &client_config = ClientConfig::GetConfig(*this);
 	if (!stream_result && client_config.result_collector) {
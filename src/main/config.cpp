@@ -64,6 +64,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(DebugForceNoCrossProduct),
     DUCKDB_LOCAL(DebugAsOfIEJoin),
     DUCKDB_LOCAL(PreferRangeJoins),
+    DUCKDB_LOCAL(ForceIndexJoin),
+    DUCKDB_LOCAL(EnableJoinFilterPushdown),
+    DUCKDB_LOCAL(EnableTopNFilterPushdown),
     DUCKDB_GLOBAL(DebugWindowMode),
     DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
     DUCKDB_GLOBAL(DefaultOrderSetting),
@@ -85,6 +88,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
+    DUCKDB_LOCAL(EnableQueryResultCacheSetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
@@ -102,6 +106,11 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_LOCAL(StreamingBufferSize),
     DUCKDB_GLOBAL(MaximumMemorySetting),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
+    DUCKDB_GLOBAL(ConnectionMemoryLimitSetting),
+    DUCKDB_LOCAL(QueryMemoryLimitSetting),
+    DUCKDB_LOCAL(QueryPrioritySetting),
+    DUCKDB_GLOBAL(QueryResultCacheMemoryLimitSetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
@@ -124,6 +133,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
+    DUCKDB_LOCAL(TableScanPrefetchLookaheadSetting),
     DUCKDB_GLOBAL(TempDirectorySetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
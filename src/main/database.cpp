@@ -12,6 +12,7 @@
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
@@ -62,6 +63,7 @@ DatabaseInstance::~DatabaseInstance() {
 	// destroy child elements
 	connection_manager.reset();
 	object_cache.reset();
+	query_result_cache.reset();
 	scheduler.reset();
 	db_manager.reset();
 	buffer_manager.reset();
@@ -226,6 +228,7 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	query_result_cache = make_uniq<QueryResultCache>(config.options.query_result_cache_memory_limit);
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -307,6 +310,10 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *query_result_cache;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -384,6 +391,7 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	} else {
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps);
+		config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
 	}
 }
 
@@ -3,6 +3,7 @@
 #include "duckdb/parser/sql_statement.hpp"
 #include "duckdb/common/exception/binder_exception.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
 namespace duckdb {
@@ -137,6 +137,23 @@ static void GetTotalCPUTime(QueryProfiler::TreeNode &node) {
 	}
 }
 
+static void RefreshExtraInfo(const QueryProfiler::TreeMap &tree_map) {
+	for (auto &entry : tree_map) {
+		auto &tree_node = entry.second.get();
+		if (tree_node.profiling_info.Enabled(MetricsType::EXTRA_INFO)) {
+			tree_node.profiling_info.metrics.extra_info = entry.first.get().ParamsToString();
+		}
+	}
+}
+
+void QueryProfiler::RefreshExtraInfo() {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	duckdb::RefreshExtraInfo(tree_map);
+}
+
 void QueryProfiler::EndQuery() {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -153,6 +170,8 @@ void QueryProfiler::EndQuery() {
 	if (IsEnabled() && !is_explain_analyze) {
 		// initialize the query info
 		if (root) {
+			// the extra info can contain information that is gathered during execution
+			duckdb::RefreshExtraInfo(tree_map);
 			query_info->query = query;
 			query_info->settings = ProfilingInfo(ClientConfig::GetConfig(context).profiler_settings);
 			if (query_info->settings.Enabled(MetricsType::OPERATOR_TIMING)) {
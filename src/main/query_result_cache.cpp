@@ -0,0 +1,293 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+QueryResultCache::QueryResultCache(idx_t memory_limit) : memory_limit(memory_limit), memory_usage(0), use_counter(0) {
+}
+
+static bool IsDeterministic(Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_FUNCTION:
+		if (expr.Cast<BoundFunctionExpression>().function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	case ExpressionClass::BOUND_AGGREGATE:
+		if (expr.Cast<BoundAggregateExpression>().function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	case ExpressionClass::BOUND_WINDOW: {
+		auto &window = expr.Cast<BoundWindowExpression>();
+		if (window.aggregate && window.aggregate->stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	bool result = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		if (result && !IsDeterministic(child)) {
+			result = false;
+		}
+	});
+	return result;
+}
+
+//! Collects the tables that are read by the plan, returns false if the result of the plan cannot be cached
+static bool CollectTables(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto table = op.Cast<LogicalGet>().GetTable();
+		if (!table || !table->IsDuckTable()) {
+			// table functions can read anything (files, settings, ...)
+			return false;
+		}
+		tables.push_back(table->GetStorage().GetDataTableInfo());
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+	case LogicalOperatorType::LOGICAL_EXTENSION_OPERATOR:
+		return false;
+	default:
+		break;
+	}
+	bool result = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *child) {
+		if (result && !IsDeterministic(**child)) {
+			result = false;
+		}
+	});
+	if (!result) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!CollectTables(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<QueryResultCacheKey> QueryResultCache::CreateKey(ClientContext &context, LogicalOperator &plan) {
+	auto result = make_uniq<QueryResultCacheKey>();
+	if (!CollectTables(plan, result->tables) || result->tables.empty()) {
+		return nullptr;
+	}
+	MemoryStream stream;
+	BinarySerializer serializer(stream);
+	try {
+		serializer.Begin();
+		plan.Serialize(serializer);
+		serializer.End();
+	} catch (NotImplementedException &ex) {
+		// not all operators can be serialized
+		return nullptr;
+	} catch (SerializationException &ex) {
+		return nullptr;
+	}
+	result->plan = string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	// extension settings (e.g. the TimeZone and Calendar of ICU) are read while executing the plan, rather than when
+	// binding it, so results computed under different values of these settings cannot be shared
+	auto &config = DBConfig::GetConfig(context);
+	for (auto &entry : config.extension_parameters) {
+		Value value;
+		if (!context.TryGetCurrentSetting(entry.first, value)) {
+			continue;
+		}
+		result->plan += '\0';
+		result->plan += entry.first;
+		result->plan += '=';
+		result->plan += value.ToString();
+	}
+	return result;
+}
+
+bool QueryResultCache::IsEnabled(ClientContext &context) {
+	return ClientConfig::GetConfig(context).enable_query_result_cache &&
+	       DBConfig::GetConfig(context).options.query_result_cache_memory_limit > 0;
+}
+
+bool QueryResultCache::GetTableVersions(ClientContext &context, const vector<weak_ptr<DataTableInfo>> &tables,
+                                        vector<transaction_t> &versions) {
+	auto &meta_transaction = MetaTransaction::Get(context);
+	if (meta_transaction.ModifiedDatabase()) {
+		// the transaction sees its own (uncommitted) changes
+		return false;
+	}
+	for (auto &table_ref : tables) {
+		auto table = table_ref.lock();
+		if (!table) {
+			return false;
+		}
+		auto version = table->GetLastCommitId();
+		auto &transaction = meta_transaction.GetTransaction(table->GetDB());
+		if (!transaction.IsDuckTransaction() || version >= transaction.Cast<DuckTransaction>().start_time) {
+			// the transaction does not see the latest committed changes of the table
+			return false;
+		}
+		versions.push_back(version);
+	}
+	return true;
+}
+
+bool QueryResultCache::IsStale(const CacheEntry &entry) {
+	for (idx_t i = 0; i < entry.tables.size(); i++) {
+		auto table = entry.tables[i].lock();
+		if (!table || table->GetLastCommitId() != entry.versions[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool IsSameTables(const vector<weak_ptr<DataTableInfo>> &left, const vector<weak_ptr<DataTableInfo>> &right) {
+	if (left.size() != right.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < left.size(); i++) {
+		auto left_table = left[i].lock();
+		if (!left_table || left_table != right[i].lock()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static unique_ptr<ColumnDataCollection> CopyCollection(Allocator &allocator, const ColumnDataCollection &source) {
+	auto result = make_uniq<ColumnDataCollection>(allocator, source.Types());
+	ColumnDataAppendState append_state;
+	result->InitializeAppend(append_state);
+	for (auto &chunk : source.Chunks()) {
+		result->Append(append_state, chunk);
+	}
+	return result;
+}
+
+unique_ptr<ColumnDataCollection> QueryResultCache::Lookup(ClientContext &context, const QueryResultCacheKey &key) {
+	vector<transaction_t> versions;
+	if (!GetTableVersions(context, key.tables, versions)) {
+		return nullptr;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key.plan);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	auto &cache_entry = entry->second;
+	if (!IsSameTables(cache_entry.tables, key.tables) || cache_entry.versions != versions) {
+		if (IsStale(cache_entry)) {
+			// one of the tables has changed: the entry can never be used again
+			memory_usage -= cache_entry.memory_usage;
+			entries.erase(entry);
+		}
+		return nullptr;
+	}
+	cache_entry.hits++;
+	cache_entry.last_used = ++use_counter;
+	return CopyCollection(Allocator::Get(context), *cache_entry.result);
+}
+
+void QueryResultCache::Insert(ClientContext &context, const QueryResultCacheKey &key,
+                              const ColumnDataCollection &result) {
+	auto result_size = result.SizeInBytes();
+	{
+		lock_guard<mutex> guard(lock);
+		if (result_size > memory_limit) {
+			return;
+		}
+	}
+	vector<transaction_t> versions;
+	if (!GetTableVersions(context, key.tables, versions)) {
+		return;
+	}
+	CacheEntry cache_entry;
+	cache_entry.tables = key.tables;
+	cache_entry.versions = std::move(versions);
+	cache_entry.result = CopyCollection(Allocator::Get(DatabaseInstance::GetDatabase(context)), result);
+	cache_entry.memory_usage = result_size;
+	cache_entry.hits = 0;
+
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key.plan);
+	if (entry != entries.end()) {
+		// replace the existing (outdated) entry
+		memory_usage -= entry->second.memory_usage;
+		entries.erase(entry);
+	}
+	EvictEntries(memory_limit - result_size);
+	cache_entry.last_used = ++use_counter;
+	memory_usage += result_size;
+	entries.emplace(key.plan, std::move(cache_entry));
+}
+
+void QueryResultCache::EvictEntries(idx_t target_size) {
+	// first drop the entries of tables that have changed since
+	for (auto it = entries.begin(); it != entries.end();) {
+		if (IsStale(it->second)) {
+			memory_usage -= it->second.memory_usage;
+			it = entries.erase(it);
+		} else {
+			it++;
+		}
+	}
+	// then evict the least recently used entries
+	while (memory_usage > target_size && !entries.empty()) {
+		auto lru_entry = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < lru_entry->second.last_used) {
+				lru_entry = it;
+			}
+		}
+		memory_usage -= lru_entry->second.memory_usage;
+		entries.erase(lru_entry);
+	}
+}
+
+void QueryResultCache::SetMemoryLimit(idx_t limit) {
+	lock_guard<mutex> guard(lock);
+	memory_limit = limit;
+	EvictEntries(memory_limit);
+}
+
+void QueryResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	memory_usage = 0;
+}
+
+vector<QueryResultCacheEntryInfo> QueryResultCache::GetEntries() {
+	lock_guard<mutex> guard(lock);
+	vector<QueryResultCacheEntryInfo> result;
+	for (auto &entry : entries) {
+		if (IsStale(entry.second)) {
+			continue;
+		}
+		QueryResultCacheEntryInfo info;
+		info.result_rows = entry.second.result->Count();
+		info.memory_usage = entry.second.memory_usage;
+		info.hits = entry.second.hits;
+		result.push_back(info);
+	}
+	return result;
+}
+
+} // namespace duckdb
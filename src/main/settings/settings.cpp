@@ -9,10 +9,12 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -238,6 +240,51 @@ Value PreferRangeJoins::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Force Index Join
+//===--------------------------------------------------------------------===//
+void ForceIndexJoin::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).force_index_join = ClientConfig().force_index_join;
+}
+
+void ForceIndexJoin::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).force_index_join = input.GetValue<bool>();
+}
+
+Value ForceIndexJoin::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_index_join);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Join Filter Pushdown
+//===--------------------------------------------------------------------===//
+void EnableJoinFilterPushdown::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_join_filter_pushdown = ClientConfig().enable_join_filter_pushdown;
+}
+
+void EnableJoinFilterPushdown::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_join_filter_pushdown = input.GetValue<bool>();
+}
+
+Value EnableJoinFilterPushdown::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_join_filter_pushdown);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Top-N Filter Pushdown
+//===--------------------------------------------------------------------===//
+void EnableTopNFilterPushdown::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_top_n_filter_pushdown = ClientConfig().enable_top_n_filter_pushdown;
+}
+
+void EnableTopNFilterPushdown::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_top_n_filter_pushdown = input.GetValue<bool>();
+}
+
+Value EnableTopNFilterPushdown::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_top_n_filter_pushdown);
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
@@ -840,6 +887,21 @@ Value EnableProgressBarPrintSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).print_progress_bar);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Query Result Cache
+//===--------------------------------------------------------------------===//
+void EnableQueryResultCacheSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_query_result_cache = input.GetValue<bool>();
+}
+
+void EnableQueryResultCacheSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_query_result_cache = ClientConfig().enable_query_result_cache;
+}
+
+Value EnableQueryResultCacheSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_query_result_cache);
+}
+
 //===--------------------------------------------------------------------===//
 // Errors As JSON
 //===--------------------------------------------------------------------===//
@@ -1134,6 +1196,150 @@ Value MaximumMemorySetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	BufferEvictionPolicy policy;
+	if (parameter == "lru") {
+		policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or 2Q.", parameter);
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(policy);
+	}
+	config.options.buffer_eviction_policy = policy;
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	auto policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(policy);
+	}
+	config.options.buffer_eviction_policy = policy;
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return "lru";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unknown buffer eviction policy setting");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Connection Memory Limit
+//===--------------------------------------------------------------------===//
+void ConnectionMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.connection_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void ConnectionMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.connection_memory_limit = DBConfig().options.connection_memory_limit;
+}
+
+Value ConnectionMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.connection_memory_limit == DConstants::INVALID_INDEX) {
+		// no limit
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.options.connection_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.query_memory_limit == DConstants::INVALID_INDEX) {
+		// no limit
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (parameter == "low") {
+		config.query_priority = QueryPriority::LOW;
+	} else if (parameter == "normal") {
+		config.query_priority = QueryPriority::NORMAL;
+	} else if (parameter == "high") {
+		config.query_priority = QueryPriority::HIGH;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option QUERY_PRIORITY \"%s\". Expected LOW, NORMAL or HIGH.", parameter);
+	}
+}
+
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	switch (config.query_priority) {
+	case QueryPriority::LOW:
+		return "low";
+	case QueryPriority::NORMAL:
+		return "normal";
+	case QueryPriority::HIGH:
+		return "high";
+	default:
+		throw InternalException("Unknown query priority setting");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Query Result Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryResultCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (limit == DConstants::INVALID_INDEX) {
+		throw InvalidInputException("The query result cache requires a memory limit");
+	}
+	if (db) {
+		db->GetQueryResultCache().SetMemoryLimit(limit);
+	}
+	config.options.query_result_cache_memory_limit = limit;
+}
+
+void QueryResultCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	auto limit = DBConfig().options.query_result_cache_memory_limit;
+	if (db) {
+		db->GetQueryResultCache().SetMemoryLimit(limit);
+	}
+	config.options.query_result_cache_memory_limit = limit;
+}
+
+Value QueryResultCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.query_result_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Streaming Buffer Size
 //===--------------------------------------------------------------------===//
@@ -1594,6 +1800,21 @@ Value SecretDirectorySetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Table Scan Prefetch Lookahead
+//===--------------------------------------------------------------------===//
+void TableScanPrefetchLookaheadSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).table_scan_prefetch_lookahead = input.GetValue<uint64_t>();
+}
+
+void TableScanPrefetchLookaheadSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).table_scan_prefetch_lookahead = ClientConfig().table_scan_prefetch_lookahead;
+}
+
+Value TableScanPrefetchLookaheadSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).table_scan_prefetch_lookahead);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -357,7 +357,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(ClientConfig::GetConfig(context).query_priority);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -409,8 +409,16 @@ void Executor::CancelTasks() {
 		events.clear();
 	}
 	// Take all pending tasks and execute them until they cancel
-	while (executor_tasks > 0) {
+	while (true) {
 		WorkOnTasks();
+		// the remaining tasks are running on other threads: wait for them to finish instead of spinning. We wake up
+		// regularly, as the tasks that are still running can schedule new tasks that we have to work on
+		static constexpr std::chrono::milliseconds WAIT_TIME = std::chrono::milliseconds(20);
+		std::unique_lock<mutex> l(executor_tasks_lock);
+		if (executor_tasks == 0) {
+			break;
+		}
+		executor_tasks_finished.wait_for(l, WAIT_TIME, [&]() { return executor_tasks == 0; });
 	}
 }
 
@@ -621,6 +629,11 @@ bool Executor::HasError() {
 	return error_manager.HasError();
 }
 
+bool Executor::IsCancelled() {
+	lock_guard<mutex> elock(executor_lock);
+	return cancelled;
+}
+
 ErrorData Executor::GetError() {
 	return error_manager.GetError();
 }
@@ -1,7 +1,9 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -28,36 +30,458 @@ struct SchedulerThread {
 };
 
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+
+//! The share of the worker threads that each priority class gets while tasks of multiple classes are waiting
+static idx_t GetPriorityWeight(idx_t priority) {
+	// LOW: 1, NORMAL: 4, HIGH: 16
+	return idx_t(1) << (2 * priority);
+}
+
+//! A task that is waiting in one of the queues, together with the producer that scheduled it. Producers outlive their
+//! tasks: e.g., the executor waits until all of its tasks have been destroyed before it destroys its producer
+struct QueuedTask {
+	ProducerToken *token = nullptr;
+	shared_ptr<Task> task;
+};
+
+//! Consumers of the shared queues move on to the next producer after every task that they dequeue. As a result, the
+//! threads visit the producers (i.e., the queries) of a priority class round-robin, without any locking.
+struct TaskQueueTraits : public duckdb_moodycamel::ConcurrentQueueDefaultTraits {
+	static const std::uint32_t EXPLICIT_CONSUMER_CONSUMPTION_QUOTA_BEFORE_ROTATE = 1;
+};
+
+typedef duckdb_moodycamel::ConcurrentQueue<QueuedTask, TaskQueueTraits> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The local task queue of a worker thread, with one deque per priority class. The worker pushes and pops tasks at the
+//! back, so that it continues with the tasks that it scheduled most recently. Other threads steal tasks from the front.
+//! Worker queues live as long as the scheduler: the queue of a worker that exits is reused by the next worker that
+//! starts, so that the list of queues can be walked without locking it.
+struct WorkerQueue {
+	explicit WorkerQueue(ConcurrentQueue &owner) : owner(owner), in_use(true) {
+	}
+
+	//! The task queue of the scheduler that the worker belongs to
+	ConcurrentQueue &owner;
+	mutex lock;
+	deque<QueuedTask> tasks[QUERY_PRIORITY_COUNT];
+	//! Whether tasks can be pushed on the queue, i.e., whether its worker is running (protected by the lock)
+	bool accepting = false;
+	//! Whether the queue belongs to a worker, a starting worker claims an unused queue by setting this
+	atomic<bool> in_use;
+	//! The next queue in the list of worker queues, this does not change after the queue has been added to the list
+	WorkerQueue *next = nullptr;
+	//! The consumer tokens of the shared queues, per priority class and node
+	vector<unique_ptr<duckdb_moodycamel::ConsumerToken>> consumer_tokens[QUERY_PRIORITY_COUNT];
+
+	//! Push a task on the queue, returns false (and leaves the task untouched) if the worker has exited
+	bool Push(ProducerToken &token, shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (!accepting) {
+			return false;
+		}
+		QueuedTask queued_task;
+		queued_task.token = &token;
+		queued_task.task = std::move(task);
+		tasks[static_cast<idx_t>(token.priority)].push_back(std::move(queued_task));
+		return true;
+	}
+	bool Pop(idx_t priority, QueuedTask &result) {
+		lock_guard<mutex> guard(lock);
+		auto &priority_tasks = tasks[priority];
+		if (priority_tasks.empty()) {
+			return false;
+		}
+		result = std::move(priority_tasks.back());
+		priority_tasks.pop_back();
+		return true;
+	}
+	//! Steal the oldest task of a priority class
+	bool Steal(idx_t priority, QueuedTask &result) {
+		lock_guard<mutex> guard(lock);
+		auto &priority_tasks = tasks[priority];
+		if (priority_tasks.empty()) {
+			return false;
+		}
+		result = std::move(priority_tasks.front());
+		priority_tasks.pop_front();
+		return true;
+	}
+	//! Steal the oldest task of a specific producer
+	bool StealFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		auto &priority_tasks = tasks[static_cast<idx_t>(token.priority)];
+		for (auto it = priority_tasks.begin(); it != priority_tasks.end(); it++) {
+			if (it->token == &token) {
+				task = std::move(it->task);
+				priority_tasks.erase(it);
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+//! The local queue of the worker thread that is running on this thread (if any). A worker of one database can run
+//! queries on another database (e.g., through a function that opens a connection), so this can belong to the
+//! scheduler of another database - see ConcurrentQueue::GetWorkerQueue
+static thread_local WorkerQueue *current_worker_queue = nullptr;
+
+//! The task queue consists of one local queue per worker thread, and one shared queue per priority class and NUMA
+//! node. Tasks that are scheduled by a worker thread are pushed on its local queue, and tasks that are rescheduled
+//! after an interrupt go back to the local queue of the worker that was executing them. All other tasks are enqueued
+//! on the shared queue of the node of the thread that schedules them.
+//! Threads first select a priority class, weighted by GetPriorityWeight, among the classes that have waiting tasks.
+//! Within the class, they take tasks from their own local queue first, then from the shared queues - visiting the
+//! producers (i.e., the queries) round-robin, so that a query with many tasks does not starve the others - and finally
+//! steal from other workers.
+//! A thread has to claim a task (ClaimTask) before it dequeues one. Tasks are counted as available only once they have
+//! been enqueued, so a thread that claimed a task always finds one. The semaphore only wakes up waiting threads.
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	ConcurrentQueue() : available_tasks(0), waiting_threads(0), dequeue_ticket(0), worker_queues(nullptr) {
+		auto node_count = NUMA::NodeCount();
+		for (idx_t priority = 0; priority < QUERY_PRIORITY_COUNT; priority++) {
+			for (idx_t node = 0; node < node_count; node++) {
+				node_queues[priority].push_back(make_uniq<concurrent_queue_t>());
+			}
+			queued_tasks[priority] = 0;
+		}
+	}
+
+	vector<unique_ptr<concurrent_queue_t>> node_queues[QUERY_PRIORITY_COUNT];
 	lightweight_semaphore_t semaphore;
+	//! The number of tasks that are waiting in any of the queues and that have not been claimed by a thread yet
+	atomic<idx_t> available_tasks;
+	//! The number of threads that are waiting on the semaphore
+	atomic<idx_t> waiting_threads;
+	//! The number of tasks per priority class. This is incremented before a task is enqueued and decremented after it
+	//! is dequeued, so it is never lower than the actual number of waiting tasks.
+	atomic<idx_t> queued_tasks[QUERY_PRIORITY_COUNT];
+	//! Used to select the priority class of the next dequeue
+	atomic<idx_t> dequeue_ticket;
+	//! The list of worker queues, new queues are added at the front
+	atomic<WorkerQueue *> worker_queues;
+	//! Lock for adding worker queues to the list
+	mutex worker_lock;
+	//! Owns the worker queues
+	vector<unique_ptr<WorkerQueue>> worker_queue_storage;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Claim one of the available tasks, returns false if there are none
+	bool ClaimTask();
+	//! Wait until a task becomes available, the timeout expires, or the thread is signalled. This does not claim the
+	//! task. Returns false if the timeout expired.
+	bool WaitForTask(int64_t timeout_usecs = -1);
+	//! Dequeue the task that was claimed with ClaimTask. If the task is not visible yet, the claim is given up and
+	//! false is returned: the caller retries through ClaimTask
+	bool DequeueClaimed(QueuedTask &result);
+	bool DequeueClaimed(shared_ptr<Task> &task);
+	//! Whether tasks of a higher priority class than the given priority are waiting
+	bool HasHigherPriorityTask(QueryPriority priority) const;
+	idx_t GetCurrentNode() const;
+
+	//! Returns the local queue of the calling thread if it is a worker thread of this queue, or nullptr otherwise
+	WorkerQueue *GetWorkerQueue() const;
+	//! Register the calling thread as a worker thread with a local queue
+	void RegisterWorker();
+	//! Unregister the calling worker thread, its remaining local tasks are moved to the shared queues
+	void UnregisterWorker();
+
+private:
+	//! Makes a task available that was enqueued (or a claim that was not used), and wakes up a waiting thread
+	void NotifyTask();
+	//! Enqueue a task on the shared queue of the current node, this does not make the task available
+	void EnqueueShared(ProducerToken &token, shared_ptr<Task> task);
+	//! Fills "order" with the priority classes in the order in which the next dequeue visits them
+	void GetPriorityOrder(idx_t order[]);
+	bool Dequeue(QueuedTask &result);
+	bool DequeueWithPriority(idx_t priority, QueuedTask &result);
+	bool DequeueShared(idx_t priority, QueuedTask &result);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, QueryPriority priority) {
+		for (auto &node_queue : queue.node_queues[static_cast<idx_t>(priority)]) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(*node_queue));
+		}
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	//! One token per node queue of the priority class of the producer
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
 };
 
+idx_t ConcurrentQueue::GetCurrentNode() const {
+	if (node_queues[0].size() == 1) {
+		return 0;
+	}
+	return NUMA::GetCurrentNode() % node_queues[0].size();
+}
+
+WorkerQueue *ConcurrentQueue::GetWorkerQueue() const {
+	if (current_worker_queue && &current_worker_queue->owner == this) {
+		return current_worker_queue;
+	}
+	return nullptr;
+}
+
+void ConcurrentQueue::NotifyTask() {
+	available_tasks++;
+	// this pairs with WaitForTask, which increments the waiting threads before it checks the available tasks: either
+	// the waiting thread sees the task, or we see the waiting thread
+	if (waiting_threads > 0) {
+		semaphore.signal();
+	}
+}
+
+bool ConcurrentQueue::ClaimTask() {
+	auto available = available_tasks.load();
+	while (available > 0) {
+		if (available_tasks.compare_exchange_weak(available, available - 1)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::WaitForTask(int64_t timeout_usecs) {
+	waiting_threads++;
+	bool signalled = true;
+	if (available_tasks == 0) {
+		signalled = timeout_usecs < 0 ? semaphore.wait() : semaphore.wait(timeout_usecs);
+	}
+	waiting_threads--;
+	return signalled;
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+	auto priority = static_cast<idx_t>(token.priority);
+	// a task that was blocked is rescheduled on the worker that was executing it, other tasks that are scheduled from
+	// a worker thread are pushed on its local queue
+	auto worker = task->blocked_worker ? task->blocked_worker.get() : GetWorkerQueue();
+	task->blocked_worker = nullptr;
+	if (worker) {
+		queued_tasks[priority]++;
+		if (worker->Push(token, task)) {
+			NotifyTask();
+			return;
+		}
+		// the worker has exited
+		queued_tasks[priority]--;
+	}
+	EnqueueShared(token, std::move(task));
+	NotifyTask();
+}
+
+void ConcurrentQueue::EnqueueShared(ProducerToken &token, shared_ptr<Task> task) {
+	auto priority = static_cast<idx_t>(token.priority);
+	auto node = GetCurrentNode();
+	QueuedTask queued_task;
+	queued_task.token = &token;
+	queued_task.task = std::move(task);
+	queued_tasks[priority]++;
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
-	} else {
+	if (!node_queues[priority][node]->enqueue(*token.token->queue_tokens[node], std::move(queued_task))) {
+		queued_tasks[priority]--;
 		throw InternalException("Could not schedule task!");
 	}
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	if (!ClaimTask()) {
+		return false;
+	}
+	auto priority = static_cast<idx_t>(token.priority);
+	auto &queues = node_queues[priority];
+	auto node = GetCurrentNode();
+	{
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		QueuedTask result;
+		for (idx_t i = 0; i < queues.size(); i++) {
+			auto queue_idx = (node + i) % queues.size();
+			if (queues[queue_idx]->try_dequeue_from_producer(*token.token->queue_tokens[queue_idx], result)) {
+				queued_tasks[priority]--;
+				task = std::move(result.task);
+				return true;
+			}
+		}
+	}
+	// steal a task of this producer from the local queue of a worker
+	for (auto worker = worker_queues.load(); worker; worker = worker->next) {
+		if (worker->StealFromProducer(token, task)) {
+			queued_tasks[priority]--;
+			return true;
+		}
+	}
+	// the available tasks belong to other producers: give up our claim
+	NotifyTask();
+	return false;
+}
+
+bool ConcurrentQueue::HasHigherPriorityTask(QueryPriority priority) const {
+	for (idx_t higher = static_cast<idx_t>(priority) + 1; higher < QUERY_PRIORITY_COUNT; higher++) {
+		if (queued_tasks[higher] > 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ConcurrentQueue::GetPriorityOrder(idx_t order[]) {
+	// pick the first class with a probability that is proportional to its weight, among the classes with tasks
+	idx_t total_weight = 0;
+	for (idx_t priority = 0; priority < QUERY_PRIORITY_COUNT; priority++) {
+		if (queued_tasks[priority] > 0) {
+			total_weight += GetPriorityWeight(priority);
+		}
+	}
+	idx_t first = QUERY_PRIORITY_COUNT - 1;
+	if (total_weight > 0) {
+		auto position = dequeue_ticket++ % total_weight;
+		for (idx_t i = 0; i < QUERY_PRIORITY_COUNT; i++) {
+			auto priority = QUERY_PRIORITY_COUNT - 1 - i;
+			if (queued_tasks[priority] == 0) {
+				continue;
+			}
+			if (position < GetPriorityWeight(priority)) {
+				first = priority;
+				break;
+			}
+			position -= GetPriorityWeight(priority);
+		}
+	}
+	// the other classes follow from high to low, so that no thread is idle while there are tasks
+	idx_t order_idx = 0;
+	order[order_idx++] = first;
+	for (idx_t i = 0; i < QUERY_PRIORITY_COUNT; i++) {
+		auto priority = QUERY_PRIORITY_COUNT - 1 - i;
+		if (priority != first) {
+			order[order_idx++] = priority;
+		}
+	}
+}
+
+bool ConcurrentQueue::DequeueShared(idx_t priority, QueuedTask &result) {
+	auto &queues = node_queues[priority];
+	auto node = GetCurrentNode();
+	auto current_worker = GetWorkerQueue();
+	for (idx_t q = 0; q < queues.size(); q++) {
+		auto queue_idx = (node + q) % queues.size();
+		if (current_worker) {
+			// worker threads dequeue with a consumer token, which visits the producers round-robin
+			auto &consumer_token = *current_worker->consumer_tokens[priority][queue_idx];
+			if (queues[queue_idx]->try_dequeue(consumer_token, result)) {
+				return true;
+			}
+		} else if (queues[queue_idx]->try_dequeue(result)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::DequeueWithPriority(idx_t priority, QueuedTask &result) {
+	if (queued_tasks[priority] == 0) {
+		return false;
+	}
+	auto current_worker = GetWorkerQueue();
+	if (current_worker && current_worker->Pop(priority, result)) {
+		queued_tasks[priority]--;
+		return true;
+	}
+	if (DequeueShared(priority, result)) {
+		queued_tasks[priority]--;
+		return true;
+	}
+	// finally, steal a task from the local queue of another worker
+	for (auto worker = worker_queues.load(); worker; worker = worker->next) {
+		if (worker != current_worker && worker->Steal(priority, result)) {
+			queued_tasks[priority]--;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(QueuedTask &result) {
+	idx_t order[QUERY_PRIORITY_COUNT];
+	GetPriorityOrder(order);
+	for (idx_t i = 0; i < QUERY_PRIORITY_COUNT; i++) {
+		if (DequeueWithPriority(order[i], result)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::DequeueClaimed(QueuedTask &result) {
+	if (Dequeue(result)) {
+		return true;
+	}
+	// the claimed task has been enqueued, but it can take a moment before it is visible: it can be on its way from
+	// the local queue of an exiting worker to a shared queue, or still be in flight in the shared queue. Give up our
+	// claim, so that the task is picked up by whichever thread claims it next
+	NotifyTask();
+	return false;
+}
+
+bool ConcurrentQueue::DequeueClaimed(shared_ptr<Task> &task) {
+	QueuedTask result;
+	if (!DequeueClaimed(result)) {
+		return false;
+	}
+	task = std::move(result.task);
+	return true;
+}
+
+void ConcurrentQueue::RegisterWorker() {
+	// reuse the queue of a worker that has exited, if there is one
+	WorkerQueue *worker = nullptr;
+	for (auto queue = worker_queues.load(); queue; queue = queue->next) {
+		bool in_use = false;
+		if (queue->in_use.compare_exchange_strong(in_use, true)) {
+			worker = queue;
+			break;
+		}
+	}
+	if (!worker) {
+		lock_guard<mutex> guard(worker_lock);
+		auto new_worker = make_uniq<WorkerQueue>(*this);
+		for (idx_t priority = 0; priority < QUERY_PRIORITY_COUNT; priority++) {
+			for (auto &node_queue : node_queues[priority]) {
+				new_worker->consumer_tokens[priority].push_back(
+				    make_uniq<duckdb_moodycamel::ConsumerToken>(*node_queue));
+			}
+		}
+		worker = new_worker.get();
+		worker->next = worker_queues.load();
+		worker_queue_storage.push_back(std::move(new_worker));
+		worker_queues.store(worker);
+	}
+	{
+		lock_guard<mutex> guard(worker->lock);
+		worker->accepting = true;
+	}
+	current_worker_queue = worker;
+}
+
+void ConcurrentQueue::UnregisterWorker() {
+	auto &worker = *current_worker_queue;
+	current_worker_queue = nullptr;
+	{
+		// nobody can push tasks on the queue anymore: move the remaining tasks to the shared queues
+		// these tasks remain available: a thread that claimed one of them finds it in the shared queue
+		lock_guard<mutex> guard(worker.lock);
+		worker.accepting = false;
+		for (idx_t priority = 0; priority < QUERY_PRIORITY_COUNT; priority++) {
+			for (auto &queued_task : worker.tasks[priority]) {
+				EnqueueShared(*queued_task.token, std::move(queued_task.task));
+				queued_tasks[priority]--;
+			}
+			worker.tasks[priority].clear();
+		}
+	}
+	worker.in_use = false;
 }
 
 #else
@@ -85,13 +509,14 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, QueryPriority priority) {
 	}
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, QueryPriority priority,
+                             bool preemptible)
+    : scheduler(scheduler), token(std::move(token)), priority(priority), preemptible(preemptible) {
 }
 
 ProducerToken::~ProducerToken() {
@@ -124,8 +549,15 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 }
 
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	auto token = make_uniq<QueueProducerToken>(*queue, QueryPriority::NORMAL);
+	auto result = make_uniq<ProducerToken>(*this, std::move(token), QueryPriority::NORMAL, false);
+	return result;
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(QueryPriority priority) {
+	auto token = make_uniq<QueueProducerToken>(*queue, priority);
+	auto result = make_uniq<ProducerToken>(*this, std::move(token), priority, true);
+	return result;
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
@@ -141,39 +573,62 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
-	shared_ptr<Task> task;
+	QueuedTask queued_task;
+	queue->RegisterWorker();
 	// loop until the marker is set to false
 	while (*marker) {
-		if (!Allocator::SupportsFlush() || allocator_background_threads) {
-			// allocator can't flush, or background threads clean up allocations, just start an untimed wait
-			queue->semaphore.wait();
-		} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
-			// no background threads, flush this threads outstanding allocations after it was idle for 0.5s
-			Allocator::ThreadFlush(allocator_flush_threshold);
-			if (!queue->semaphore.wait(Allocator::DecayDelay() * 1000000 - INITIAL_FLUSH_WAIT)) {
-				// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
-				// mark it as idle and start an untimed wait
-				Allocator::ThreadIdle();
-				queue->semaphore.wait();
+		if (!queue->ClaimTask()) {
+			// no task is available: wait until one is scheduled (or until we are signalled), and try again
+			if (!Allocator::SupportsFlush() || allocator_background_threads) {
+				// allocator can't flush, or background threads clean up allocations, just start an untimed wait
+				queue->WaitForTask();
+			} else if (!queue->WaitForTask(INITIAL_FLUSH_WAIT)) {
+				// no background threads, flush this threads outstanding allocations after it was idle for 0.5s
+				Allocator::ThreadFlush(allocator_flush_threshold);
+				if (!queue->WaitForTask(Allocator::DecayDelay() * 1000000 - INITIAL_FLUSH_WAIT)) {
+					// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
+					// mark it as idle and start an untimed wait
+					Allocator::ThreadIdle();
+					queue->WaitForTask();
+				}
 			}
+			continue;
+		}
+		if (!queue->DequeueClaimed(queued_task)) {
+			continue;
+		}
+		auto task = std::move(queued_task.task);
+		auto token = queued_task.token;
+		queued_task.token = nullptr;
+		auto preemptible = token && token->preemptible;
+		auto mode = preemptible ? TaskExecutionMode::PROCESS_PARTIAL : TaskExecutionMode::PROCESS_ALL;
+		auto execute_result = task->Execute(mode);
+		while (preemptible && execute_result == TaskExecutionResult::TASK_NOT_FINISHED &&
+		       !queue->HasHigherPriorityTask(token->priority)) {
+			execute_result = task->Execute(mode);
 		}
-		if (queue->q.try_dequeue(task)) {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
+		switch (execute_result) {
+		case TaskExecutionResult::TASK_FINISHED:
+		case TaskExecutionResult::TASK_ERROR:
+			task.reset();
+			break;
+		case TaskExecutionResult::TASK_NOT_FINISHED:
+			if (!preemptible) {
 				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
 			}
+			// a task of a higher priority class is waiting: put this task back on our local queue
+			queue->Enqueue(*token, std::move(task));
+			break;
+		case TaskExecutionResult::TASK_BLOCKED:
+			// once the task can continue, it is rescheduled on this worker
+			task->blocked_worker = queue->GetWorkerQueue();
+			task->Deschedule();
+			task.reset();
+			break;
 		}
 	}
+	queue->UnregisterWorker();
 	// this thread will exit, flush all of its outstanding allocations
 	if (Allocator::SupportsFlush()) {
 		Allocator::ThreadFlush(0);
@@ -190,9 +645,12 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->ClaimTask()) {
 			return completed_tasks;
 		}
+		if (!queue->DequeueClaimed(task)) {
+			continue;
+		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 		switch (execute_result) {
@@ -219,9 +677,16 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
-		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
-			return;
+		if (!queue->ClaimTask()) {
+			queue->WaitForTask(TASK_TIMEOUT_USECS);
+			if (!queue->ClaimTask()) {
+				return;
+			}
+		}
+		if (!queue->DequeueClaimed(task)) {
+			// the task is not visible yet: this does not count as one of the tasks
+			i--;
+			continue;
 		}
 		try {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -247,7 +712,11 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, idx_t node) {
+	if (NUMA::NodeCount() > 1) {
+		// keep the thread (and the memory that it touches first) on a single node
+		NUMA::PinThreadToNode(node);
+	}
 	scheduler->ExecuteForever(marker);
 }
 #endif
@@ -334,7 +803,9 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				// spread the threads evenly over the NUMA nodes
+				auto node = threads.size() % NUMA::NodeCount();
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), node);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
@@ -67,10 +67,15 @@ FilterPropagateResult ConjunctionAndFilter::CheckStatistics(BaseStatistics &stat
 string ConjunctionAndFilter::ToString(const string &column_name) {
 	string result;
 	for (idx_t i = 0; i < child_filters.size(); i++) {
-		if (i > 0) {
+		auto child_str = child_filters[i]->ToString(column_name);
+		if (child_str.empty()) {
+			// e.g. a dynamic filter that has not been set yet
+			continue;
+		}
+		if (!result.empty()) {
 			result += " AND ";
 		}
-		result += child_filters[i]->ToString(column_name);
+		result += child_str;
 	}
 	return result;
 }
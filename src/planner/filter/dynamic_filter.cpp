@@ -0,0 +1,88 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+namespace duckdb {
+
+void DynamicFilterData::SetFilter(unique_ptr<TableFilter> filter_p) {
+	shared_ptr<TableFilter> new_filter(std::move(filter_p));
+	lock_guard<mutex> guard(lock);
+	// the previous filter is destroyed once the last scan that is reading it lets go of it
+	filter = std::move(new_filter);
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	filter.reset();
+}
+
+shared_ptr<TableFilter> DynamicFilterData::GetFilter() const {
+	lock_guard<mutex> guard(lock);
+	return filter;
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+bool DynamicFilter::SupportsType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+shared_ptr<TableFilter> DynamicFilter::GetFilter() const {
+	if (!filter_data) {
+		return nullptr;
+	}
+	return filter_data->GetFilter();
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto filter = GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	auto filter = GetFilter();
+	if (!filter) {
+		// the filter has not been set (yet): there is nothing to display
+		return string();
+	}
+	return filter->ToString(column_name);
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+} // namespace duckdb
@@ -45,6 +45,14 @@ shared_ptr<BlockHandle> BlockManager::ConvertToPersistent(block_id_t block_id, s
 	D_ASSERT(new_block->state == BlockState::BLOCK_UNLOADED);
 	D_ASSERT(new_block->readers == 0);
 
+	if (old_block->readers > 1) {
+		// the old block is still pinned by someone else, e.g., by a scan of the transaction-local data that is being
+		// written optimistically: we cannot take the buffer away from them
+		// write the data to disk instead, the new block is loaded from there when it is pinned
+		Write(*old_block->buffer, block_id);
+		return new_block;
+	}
+
 	// move the data from the old block into data for the new block
 	new_block->state = BlockState::BLOCK_LOADED;
 	new_block->buffer = ConvertBlock(block_id, *old_block->buffer);
@@ -85,6 +93,12 @@ MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
 
+void BlockManager::BatchReadBlocks(vector<BlockRun> &runs) {
+	for (auto &run : runs) {
+		ReadBlocks(*run.buffer, run.start_block, run.block_count);
+	}
+}
+
 void BlockManager::Truncate() {
 }
 
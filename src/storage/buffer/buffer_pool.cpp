@@ -1,6 +1,7 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/common/chrono.hpp"
@@ -193,9 +194,10 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : current_memory(0), maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
+      eviction_policy(BufferEvictionPolicy::LRU), block_reference_clock(0),
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+	queues.reserve(FILE_BUFFER_TYPE_COUNT + 1);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT + 1; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
@@ -206,11 +208,11 @@ BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
+	auto queue_idx = SelectEvictionQueue(*handle);
+	auto &queue = *queues[queue_idx];
 	auto ts = ++handle->eviction_seq_num;
 	if (track_eviction_timestamps) {
 		handle->lru_timestamp_msec =
@@ -221,19 +223,75 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
 	}
+	handle->eviction_queue_idx = queue_idx;
 
 	// Get the eviction queue for the buffer type and add it
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
+idx_t BufferPool::SelectEvictionQueue(BlockHandle &handle) {
+	auto queue_idx = GetEvictionQueueIndex(handle.buffer->type);
+	if (handle.buffer->type != FileBufferType::BLOCK) {
+		return queue_idx;
+	}
+	if (handle.prefetched) {
+		// the block was loaded ahead of a scan that has not read it yet: loading it is not a reference of the block.
+		// Otherwise, the read of the scan would look like a re-reference and promote every prefetched block
+		return eviction_policy == BufferEvictionPolicy::LRU ? queue_idx : RECENT_BLOCK_QUEUE;
+	}
+	// the clock keeps ticking under every policy, so that the policy can be changed at any time
+	auto now = ++block_reference_clock;
+	auto last_reference = handle.last_reference;
+	auto distance = now - last_reference;
+	if (last_reference == 0 || distance > CORRELATED_REFERENCE_WINDOW) {
+		// this reference starts a new burst of references, the correlated references of a burst are measured from
+		// its first reference: a block that keeps being referenced is reused after the window at some point
+		handle.last_reference = now;
+	}
+	if (eviction_policy == BufferEvictionPolicy::LRU) {
+		return queue_idx;
+	}
+	if (handle.eviction_queue_idx == queue_idx) {
+		// the block is frequently referenced, and has not been evicted since
+		return queue_idx;
+	}
+	if (last_reference == 0) {
+		// first reference of this block
+		return RECENT_BLOCK_QUEUE;
+	}
+	if (distance <= CORRELATED_REFERENCE_WINDOW) {
+		// a correlated reference
+		return RECENT_BLOCK_QUEUE;
+	}
+	// we remember the last reference of blocks that have been evicted from the pool (the "ghost" entries of 2Q):
+	// a block that is reused within the window in which the pool could have kept it is frequently referenced
+	auto capacity = MaxValue<idx_t>(maximum_memory / MaxValue<idx_t>(handle.memory_usage, 1), 1);
+	if (distance > capacity) {
+		return RECENT_BLOCK_QUEUE;
+	}
+	return queue_idx;
+}
+
+idx_t BufferPool::GetEvictionQueueIndex(FileBufferType type) {
+	return uint8_t(type) - 1;
+}
+
 EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
-	return *queues[uint8_t(type) - 1];
+	return *queues[GetEvictionQueueIndex(type)];
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -264,7 +322,14 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
+	// First, we try to evict persistent table data that has only been referenced once recently
+	auto recent_block_result =
+	    EvictBlocksInternal(*queues[RECENT_BLOCK_QUEUE], tag, extra_memory, memory_limit, buffer);
+	if (recent_block_result.success) {
+		return recent_block_result;
+	}
+
+	// Then, we try to evict the remaining persistent table data
 	auto block_result =
 	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
 	if (block_result.success) {
@@ -283,6 +348,16 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 	                           buffer);
 }
 
+//! Whether the memory of the buffer is on the NUMA node of the calling thread, i.e., whether re-using it keeps the
+//! memory accesses of the calling thread local
+static bool IsOnCurrentNode(FileBuffer &buffer) {
+	if (NUMA::NodeCount() == 1) {
+		return true;
+	}
+	auto node = NUMA::GetMemoryNode(buffer.InternalBuffer());
+	return node == DConstants::INVALID_INDEX || node == NUMA::GetCurrentNode();
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
                                                            idx_t memory_limit, unique_ptr<FileBuffer> *buffer) {
 	TempBufferPoolReservation r(tag, *this, extra_memory);
@@ -294,7 +369,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		if (buffer && handle->buffer->AllocSize() == extra_memory && IsOnCurrentNode(*handle->buffer)) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
 			found = true;
@@ -381,6 +456,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		queues[RECENT_BLOCK_QUEUE]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
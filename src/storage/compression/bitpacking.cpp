@@ -9,6 +9,9 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -871,6 +874,129 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+//! Checks the filter against the range of values [min_value, max_value] of a metadata group
+static FilterPropagateResult BitpackingCheckRange(const BaseStatistics &stats, const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.constant.type() != stats.GetType()) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return NumericStats::CheckZonemap(stats, constant_filter.comparison_type, constant_filter.constant);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			auto child_result = BitpackingCheckRange(stats, *child_filter);
+			if (child_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+			if (child_result != FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+				result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return result;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                      SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+		scan_state.LoadNextGroup();
+	}
+
+	// the header of a CONSTANT or FOR group bounds the values in the group: if the vector lies within a single group,
+	// the filter can often be decided for the entire vector without unpacking the values
+	auto range_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	auto &mode = scan_state.current_group.mode;
+	if (segment.type.InternalType() == GetTypeId<T>() &&
+	    scan_state.current_group_offset + scan_count <= BITPACKING_METADATA_GROUP_SIZE &&
+	    (mode == BitpackingMode::CONSTANT ||
+	     (mode == BitpackingMode::FOR && scan_state.current_width < MinValue<idx_t>(sizeof(T) * 8, 64)))) {
+		auto stats = NumericStats::CreateEmpty(segment.type);
+		if (mode == BitpackingMode::CONSTANT) {
+			NumericStats::Update<T>(stats, scan_state.current_constant);
+		} else {
+			// the values are offsets of at most (2^width - 1) on top of the frame of reference
+			auto max_delta = T_U((uint64_t(1) << scan_state.current_width) - 1);
+			auto headroom = T_U(NumericLimits<T>::Maximum()) - T_U(scan_state.current_frame_of_reference);
+			auto max_value =
+			    max_delta >= headroom ? NumericLimits<T>::Maximum()
+			                          : static_cast<T>(T_U(scan_state.current_frame_of_reference) + max_delta);
+			NumericStats::Update<T>(stats, scan_state.current_frame_of_reference);
+			NumericStats::Update<T>(stats, max_value);
+		}
+		range_result = BitpackingCheckRange(stats, filter);
+	}
+
+	if (range_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		// none of the rows pass the filter: we do not need to unpack the values
+		sel_count = 0;
+		scan_state.Skip(segment, scan_count);
+		return;
+	}
+	BitpackingScan<T>(segment, state, scan_count, result);
+	if (range_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+		return;
+	}
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, sel_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+template <class T>
+void BitpackingSelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      const SelectionVector &sel, idx_t sel_count) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+		scan_state.LoadNextGroup();
+	}
+
+	T *result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	if (scan_state.current_group.mode != BitpackingMode::FOR ||
+	    scan_state.current_group_offset + vector_count > BITPACKING_METADATA_GROUP_SIZE) {
+		// scan the entire vector, and move the selected rows to the front
+		BitpackingScan<T>(segment, state, vector_count, result);
+		for (idx_t i = 0; i < sel_count; i++) {
+			result_data[i] = result_data[sel.get_index(i)];
+		}
+		return;
+	}
+
+	// in a FOR group every value can be decoded on its own: only unpack the algorithm groups with selected rows
+	bool skip_sign_extend = true;
+	idx_t unpacked_group = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto offset_in_group = scan_state.current_group_offset + sel.get_index(i);
+		auto algorithm_group = offset_in_group / BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		if (algorithm_group != unpacked_group) {
+			data_ptr_t decompression_group_start_pointer =
+			    scan_state.current_group_ptr +
+			    algorithm_group * BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE * scan_state.current_width / 8;
+			BitpackingPrimitives::UnPackBlock<T>(data_ptr_cast(scan_state.decompression_buffer),
+			                                     decompression_group_start_pointer, scan_state.current_width,
+			                                     skip_sign_extend);
+			unpacked_group = algorithm_group;
+		}
+		result_data[i] =
+		    scan_state.decompression_buffer[offset_in_group % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+	}
+	ApplyFrameOfReference<T>(result_data, scan_state.current_frame_of_reference, sel_count);
+	scan_state.current_group_offset += vector_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -942,11 +1068,19 @@ void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_c
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
-	                           BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
-	                           BitpackingInitCompression<T, WRITE_STATISTICS>, BitpackingCompress<T, WRITE_STATISTICS>,
-	                           BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
-	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	CompressionFunction function(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
+	                             BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
+	                             BitpackingInitCompression<T, WRITE_STATISTICS>,
+	                             BitpackingCompress<T, WRITE_STATISTICS>,
+	                             BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
+	                             BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>,
+	                             BitpackingSkip<T>);
+	if (WRITE_STATISTICS) {
+		// segments without statistics hold the offsets of lists, these are never filtered
+		function.filter = BitpackingFilter<T>;
+	}
+	function.select = BitpackingSelect<T>;
+	return function;
 }
 
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
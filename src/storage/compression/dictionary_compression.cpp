@@ -8,6 +8,7 @@
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/string_uncompressed.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 
 namespace duckdb {
 
@@ -107,6 +108,10 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
+	static void StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+	                         const SelectionVector &sel, idx_t sel_count);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -443,6 +448,12 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The number of strings in the dictionary
+	idx_t dictionary_size = 0;
+	//! The filter that was last evaluated on the dictionary (if any)
+	optional_ptr<const TableFilter> dictionary_filter;
+	//! For each string in the dictionary, whether or not it passes the dictionary_filter
+	unsafe_unique_array<bool> dictionary_filter_result;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -462,6 +473,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -553,6 +565,88 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter) {
+	StringScan(segment, state, scan_count, result);
+	if (result.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		// the strings were decompressed (the vector is not aligned with the bitpacking groups): filter them as usual
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(scan_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, sel_count);
+		return;
+	}
+
+	// evaluate the filter once per string in the dictionary, the result is reused for all vectors of the segment
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	if (scan_state.dictionary_filter.get() != &filter) {
+		auto &dictionary = *scan_state.dictionary;
+		UnifiedVectorFormat dictionary_data;
+		dictionary.ToUnifiedFormat(scan_state.dictionary_size, dictionary_data);
+		SelectionVector dictionary_sel;
+		idx_t approved_count = scan_state.dictionary_size;
+		ColumnSegment::FilterSelection(dictionary_sel, dictionary, dictionary_data, filter, scan_state.dictionary_size,
+		                               approved_count);
+
+		scan_state.dictionary_filter_result = make_unsafe_uniq_array<bool>(scan_state.dictionary_size);
+		std::fill_n(scan_state.dictionary_filter_result.get(), scan_state.dictionary_size, false);
+		for (idx_t i = 0; i < approved_count; i++) {
+			scan_state.dictionary_filter_result[dictionary_sel.get_index(i)] = true;
+		}
+		scan_state.dictionary_filter = &filter;
+	}
+
+	// map the dictionary codes of the rows to the result of their string
+	auto &codes = DictionaryVector::SelVector(result);
+	auto &filter_result = scan_state.dictionary_filter_result;
+	SelectionVector result_sel(sel_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		const auto idx = sel.get_index(i);
+		result_sel.set_index(result_count, idx);
+		result_count += filter_result[codes.get_index(idx)];
+	}
+	sel.Initialize(result_sel);
+	sel_count = result_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                                Vector &result, const SelectionVector &sel, idx_t sel_count) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
+	auto dict_child_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	// only unpack the string numbers of the algorithm groups that contain selected rows
+	sel_t decompression_buffer[BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+	idx_t unpacked_group = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row_idx = start + sel.get_index(i);
+		auto algorithm_group = row_idx / BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		if (algorithm_group != unpacked_group) {
+			auto group_start = algorithm_group * BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+			data_ptr_t src = &base_data[(group_start * scan_state.current_width) / 8];
+			BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(decompression_buffer), src,
+			                                          BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE,
+			                                          scan_state.current_width);
+			unpacked_group = algorithm_group;
+		}
+		auto string_number = decompression_buffer[row_idx % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+		result_data[i] = dict_child_data[string_number];
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -650,13 +744,16 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	CompressionFunction function(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	function.select = DictionaryCompressionStorage::StringSelect;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const CompressionInfo &info) {
@@ -74,6 +74,39 @@ void ConstantScanFunction(ColumnSegment &segment, ColumnScanState &state, idx_t
 	result.SetVectorType(VectorType::CONSTANT_VECTOR);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void ConstantFilterFunction(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                            SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	ConstantScanFunction<T>(segment, state, scan_count, result);
+
+	// all rows have the same value: the filter only has to be evaluated once
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(1, vdata);
+	SelectionVector constant_sel;
+	idx_t approved_count = 1;
+	ColumnSegment::FilterSelection(constant_sel, result, vdata, filter, 1, approved_count);
+	if (approved_count == 0) {
+		sel_count = 0;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+void ConstantSelectFunctionValidity(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                    Vector &result, const SelectionVector &sel, idx_t sel_count) {
+	ConstantScanFunctionValidity(segment, state, sel_count, result);
+}
+
+template <class T>
+void ConstantSelectFunction(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                            const SelectionVector &sel, idx_t sel_count) {
+	ConstantScanFunction<T>(segment, state, sel_count, result);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -92,16 +125,22 @@ void ConstantFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row
 //===--------------------------------------------------------------------===//
 CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::BIT);
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunctionValidity,
-	                           ConstantScanPartialValidity, ConstantFetchRowValidity, UncompressedFunctions::EmptySkip);
+	CompressionFunction function(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	                             nullptr, nullptr, ConstantInitScan, ConstantScanFunctionValidity,
+	                             ConstantScanPartialValidity, ConstantFetchRowValidity,
+	                             UncompressedFunctions::EmptySkip);
+	function.select = ConstantSelectFunctionValidity;
+	return function;
 }
 
 template <class T>
 CompressionFunction ConstantGetFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
-	                           ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	CompressionFunction function(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	                             nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
+	                             ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	function.filter = ConstantFilterFunction<T>;
+	function.select = ConstantSelectFunction<T>;
+	return function;
 }
 
 CompressionFunction ConstantFun::GetFunction(PhysicalType data_type) {
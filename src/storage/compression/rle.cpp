@@ -373,6 +373,102 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// find the runs that overlap with this vector
+	rle_count_t run_lengths[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	for (idx_t scanned = 0; scanned < scan_count; run_count++) {
+		const auto entry_pos = scan_state.entry_pos + run_count;
+		const auto run_start = run_count == 0 ? scan_state.position_in_entry : 0;
+		run_lengths[run_count] =
+		    UnsafeNumericCast<rle_count_t>(MinValue<idx_t>(index_pointer[entry_pos] - run_start, scan_count - scanned));
+		scanned += run_lengths[run_count];
+	}
+
+	// evaluate the filter once per run, directly on the values in the segment
+	Vector run_values(result.GetType(), data_ptr_cast(data_pointer + scan_state.entry_pos));
+	UnifiedVectorFormat run_data;
+	run_values.ToUnifiedFormat(run_count, run_data);
+	SelectionVector run_sel;
+	idx_t approved_run_count = run_count;
+	ColumnSegment::FilterSelection(run_sel, run_values, run_data, filter, run_count, approved_run_count);
+
+	if (approved_run_count == 0) {
+		// none of the rows pass the filter: we do not need to scan the values
+		sel_count = 0;
+		scan_state.Skip(segment, scan_count);
+		return;
+	}
+	RLEScan<T>(segment, state, scan_count, result);
+	if (approved_run_count == run_count) {
+		// all rows pass the filter
+		return;
+	}
+
+	bool run_passes[STANDARD_VECTOR_SIZE];
+	std::fill_n(run_passes, run_count, false);
+	for (idx_t i = 0; i < approved_run_count; i++) {
+		run_passes[run_sel.get_index(i)] = true;
+	}
+	bool row_passes[STANDARD_VECTOR_SIZE];
+	idx_t row_idx = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		std::fill_n(row_passes + row_idx, run_lengths[run_idx], run_passes[run_idx]);
+		row_idx += run_lengths[run_idx];
+	}
+
+	SelectionVector result_sel(sel_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		const auto idx = sel.get_index(i);
+		result_sel.set_index(result_count, idx);
+		result_count += row_passes[idx];
+	}
+	sel.Initialize(result_sel);
+	sel_count = result_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLESelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+               const SelectionVector &sel, idx_t sel_count) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	// the selected rows are in increasing order: walk over the runs to find the run of every selected row
+	auto entry_pos = scan_state.entry_pos;
+	idx_t run_end = index_pointer[entry_pos] - scan_state.position_in_entry;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row_idx = sel.get_index(i);
+		D_ASSERT(i == 0 || row_idx > sel.get_index(i - 1));
+		while (row_idx >= run_end) {
+			entry_pos++;
+			run_end += index_pointer[entry_pos];
+		}
+		result_data[i] = data_pointer[entry_pos];
+	}
+	scan_state.Skip(segment, vector_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -392,10 +488,16 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	CompressionFunction function(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                             RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                             RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                             RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	if (WRITE_STATISTICS) {
+		// segments without statistics hold the offsets of lists, these are never filtered
+		function.filter = RLEFilter<T>;
+	}
+	function.select = RLESelect<T>;
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
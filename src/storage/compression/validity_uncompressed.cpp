@@ -375,6 +375,25 @@ void ValidityScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_cou
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+void ValiditySelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                    const SelectionVector &sel, idx_t sel_count) {
+	result.Flatten(sel_count);
+
+	auto &scan_state = state.scan_state->Cast<ValidityScanState>();
+	D_ASSERT(scan_state.block_id == segment.block->BlockId());
+	auto start = segment.GetRelativeIndex(state.row_index);
+	ValidityMask input_mask(reinterpret_cast<validity_t *>(scan_state.handle.Ptr() + segment.GetBlockOffset()));
+	auto &result_mask = FlatVector::Validity(result);
+	for (idx_t i = 0; i < sel_count; i++) {
+		if (!input_mask.RowIsValidUnsafe(start + sel.get_index(i))) {
+			result_mask.SetInvalid(i);
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -468,12 +487,14 @@ void ValidityRevertAppend(ColumnSegment &segment, idx_t start_row) {
 //===--------------------------------------------------------------------===//
 CompressionFunction ValidityUncompressed::GetFunction(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::BIT);
-	return CompressionFunction(CompressionType::COMPRESSION_UNCOMPRESSED, data_type, ValidityInitAnalyze,
-	                           ValidityAnalyze, ValidityFinalAnalyze, UncompressedFunctions::InitCompression,
-	                           UncompressedFunctions::Compress, UncompressedFunctions::FinalizeCompress,
-	                           ValidityInitScan, ValidityScan, ValidityScanPartial, ValidityFetchRow,
-	                           UncompressedFunctions::EmptySkip, ValidityInitSegment, ValidityInitAppend,
-	                           ValidityAppend, ValidityFinalizeAppend, ValidityRevertAppend);
+	CompressionFunction function(CompressionType::COMPRESSION_UNCOMPRESSED, data_type, ValidityInitAnalyze,
+	                             ValidityAnalyze, ValidityFinalAnalyze, UncompressedFunctions::InitCompression,
+	                             UncompressedFunctions::Compress, UncompressedFunctions::FinalizeCompress,
+	                             ValidityInitScan, ValidityScan, ValidityScanPartial, ValidityFetchRow,
+	                             UncompressedFunctions::EmptySkip, ValidityInitSegment, ValidityInitAppend,
+	                             ValidityAppend, ValidityFinalizeAppend, ValidityRevertAppend);
+	function.select = ValiditySelect;
+	return function;
 }
 
 } // namespace duckdb
@@ -0,0 +1,548 @@
+#include "duckdb/common/types/vector_buffer.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, a sequence of independently compressed frames and the metadata of these frames.
+// Every frame holds the lengths followed by the data of up to STANDARD_VECTOR_SIZE consecutive strings, so scans only
+// decompress the frames that overlap with the scanned rows.
+typedef struct {
+	uint32_t frame_count;
+	uint32_t frame_metadata_offset;
+} zstd_compression_header_t;
+
+typedef struct {
+	uint32_t row_count;
+	uint32_t compressed_offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_metadata_t;
+
+struct ZSTDStorage {
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! Decompressing a frame is a lot more expensive than scanning the lightweight encodings,
+	//! so ZSTD is only picked when it is smaller by a wide margin
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 2.0;
+	//! Unless it is forced, ZSTD is only considered for columns with long strings
+	static constexpr idx_t MINIMUM_AVERAGE_STRING_LENGTH = 32;
+	//! Only one out of every ANALYZE_SAMPLE_RATE frames is compressed during the analysis
+	static constexpr idx_t ANALYZE_SAMPLE_RATE = 4;
+
+	//! The maximum uncompressed size of a frame
+	static idx_t GetFrameLimit(idx_t block_size) {
+		return block_size / 4;
+	}
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+};
+
+//===--------------------------------------------------------------------===//
+// Frame Builder
+//===--------------------------------------------------------------------===//
+//! Collects the strings of a single frame, and compresses them
+struct ZSTDFrameBuilder {
+	vector<uint32_t> lengths;
+	vector<char> string_data;
+	vector<data_t> uncompressed;
+	vector<data_t> compressed;
+
+	idx_t RowCount() const {
+		return lengths.size();
+	}
+
+	idx_t UncompressedSize() const {
+		return lengths.size() * sizeof(uint32_t) + string_data.size();
+	}
+
+	bool HasSpace(idx_t string_size, idx_t frame_limit) const {
+		if (lengths.size() >= STANDARD_VECTOR_SIZE) {
+			return false;
+		}
+		return UncompressedSize() + sizeof(uint32_t) + string_size <= frame_limit;
+	}
+
+	void Add(const string_t &str) {
+		auto size = str.GetSize();
+		lengths.push_back(UnsafeNumericCast<uint32_t>(size));
+		string_data.insert(string_data.end(), str.GetData(), str.GetData() + size);
+	}
+
+	//! Compresses the frame into the compressed buffer, and returns the compressed size
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context) {
+		D_ASSERT(!lengths.empty());
+		auto uncompressed_size = UncompressedSize();
+		auto lengths_size = lengths.size() * sizeof(uint32_t);
+		uncompressed.resize(uncompressed_size);
+		memcpy(uncompressed.data(), lengths.data(), lengths_size);
+		if (!string_data.empty()) {
+			memcpy(uncompressed.data() + lengths_size, string_data.data(), string_data.size());
+		}
+
+		compressed.resize(duckdb_zstd::ZSTD_compressBound(uncompressed_size));
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, compressed.data(), compressed.size(),
+		                                                      uncompressed.data(), uncompressed_size,
+		                                                      ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD string compression failed: %s",
+			                        duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		return compressed_size;
+	}
+
+	void Reset() {
+		lengths.clear();
+		string_data.clear();
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState(const CompressionInfo &info, bool forced)
+	    : AnalyzeState(info), forced(forced), context(duckdb_zstd::ZSTD_createCCtx()) {
+	}
+
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void FlushFrame() {
+		if (frame.RowCount() == 0) {
+			return;
+		}
+		auto uncompressed_size = frame.UncompressedSize();
+		if (frame_count % ZSTDStorage::ANALYZE_SAMPLE_RATE == 0) {
+			sampled_uncompressed_size += uncompressed_size;
+			sampled_compressed_size += frame.Compress(context);
+		}
+		total_uncompressed_size += uncompressed_size;
+		frame_count++;
+		frame.Reset();
+	}
+
+	//! Whether ZSTD was forced through the force_compression setting
+	bool forced;
+	duckdb_zstd::ZSTD_CCtx *context;
+	ZSTDFrameBuilder frame;
+
+	idx_t valid_count = 0;
+	idx_t total_string_size = 0;
+	idx_t frame_count = 0;
+	idx_t total_uncompressed_size = 0;
+	idx_t sampled_uncompressed_size = 0;
+	idx_t sampled_compressed_size = 0;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	auto forced = config.options.force_compression == CompressionType::COMPRESSION_ZSTD;
+	CompressionInfo info(Storage::BLOCK_SIZE, type);
+	return make_uniq<ZSTDAnalyzeState>(info, forced);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	auto frame_limit = GetFrameLimit(state.info.GetBlockSize());
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		// NULLs are stored as empty strings
+		string_t str;
+		if (vdata.validity.RowIsValid(idx)) {
+			str = data[idx];
+			state.valid_count++;
+			state.total_string_size += str.GetSize();
+		} else {
+			str = string_t(nullptr, 0);
+		}
+		if (sizeof(uint32_t) + str.GetSize() > frame_limit) {
+			// the string does not fit in a frame
+			return false;
+		}
+		if (!state.frame.HasSpace(str.GetSize(), frame_limit)) {
+			state.FlushFrame();
+		}
+		state.frame.Add(str);
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	state.FlushFrame();
+	if (state.frame_count == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	if (!state.forced &&
+	    (state.valid_count == 0 || state.total_string_size < state.valid_count * MINIMUM_AVERAGE_STRING_LENGTH)) {
+		return DConstants::INVALID_INDEX;
+	}
+
+	// extrapolate the compression ratio of the sampled frames
+	D_ASSERT(state.sampled_uncompressed_size > 0);
+	auto compression_ratio = double(state.sampled_compressed_size) / double(state.sampled_uncompressed_size);
+	auto estimated_data_size = double(state.total_uncompressed_size) * compression_ratio;
+	auto metadata_size = double(state.frame_count * sizeof(zstd_frame_metadata_t));
+	auto usable_block_size = double(state.info.GetBlockSize() - sizeof(zstd_compression_header_t));
+	auto segment_count = (estimated_data_size + metadata_size) / usable_block_size + 1;
+	auto estimated_size =
+	    estimated_data_size + metadata_size + segment_count * double(sizeof(zstd_compression_header_t));
+
+	return NumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame_stats(StringStats::CreateEmpty(checkpointer.GetType())), context(duckdb_zstd::ZSTD_createCCtx()) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		frames.clear();
+		data_size = 0;
+	}
+
+	void AddString(const string_t &str) {
+		if (!frame.HasSpace(str.GetSize(), ZSTDStorage::GetFrameLimit(info.GetBlockSize()))) {
+			FlushFrame();
+		}
+		frame.Add(str);
+		StringStats::Update(frame_stats, str);
+	}
+
+	void AddNull() {
+		if (!frame.HasSpace(0, ZSTDStorage::GetFrameLimit(info.GetBlockSize()))) {
+			FlushFrame();
+		}
+		frame.Add(string_t(nullptr, 0));
+	}
+
+	//! The offset of the frame metadata, which directly follows the compressed frames
+	idx_t GetMetadataOffset(idx_t compressed_size) const {
+		return AlignValue<idx_t, sizeof(uint32_t)>(sizeof(zstd_compression_header_t) + compressed_size);
+	}
+
+	bool HasEnoughSpace(idx_t compressed_size) const {
+		auto required_size =
+		    GetMetadataOffset(data_size + compressed_size) + (frames.size() + 1) * sizeof(zstd_frame_metadata_t);
+		return required_size <= info.GetBlockSize();
+	}
+
+	//! Compresses the pending frame and writes it to the current segment
+	void FlushFrame() {
+		if (frame.RowCount() == 0) {
+			return;
+		}
+		auto compressed_size = frame.Compress(context);
+		if (!HasEnoughSpace(compressed_size)) {
+			Flush();
+			if (!HasEnoughSpace(compressed_size)) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+
+		auto frame_offset = sizeof(zstd_compression_header_t) + data_size;
+		memcpy(current_handle.Ptr() + frame_offset, frame.compressed.data(), compressed_size);
+
+		zstd_frame_metadata_t metadata;
+		metadata.row_count = NumericCast<uint32_t>(frame.RowCount());
+		metadata.compressed_offset = NumericCast<uint32_t>(frame_offset);
+		metadata.compressed_size = NumericCast<uint32_t>(compressed_size);
+		metadata.uncompressed_size = NumericCast<uint32_t>(frame.UncompressedSize());
+		frames.push_back(metadata);
+		data_size += compressed_size;
+
+		current_segment->count += frame.RowCount();
+		current_segment->stats.statistics.Merge(frame_stats);
+		frame_stats = StringStats::CreateEmpty(checkpointer.GetType());
+		frame.Reset();
+	}
+
+	void Flush(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		auto segment_size = Finalize();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	idx_t Finalize() {
+		auto base_ptr = current_handle.Ptr();
+		auto data_end = sizeof(zstd_compression_header_t) + data_size;
+		auto metadata_offset = GetMetadataOffset(data_size);
+		auto metadata_size = frames.size() * sizeof(zstd_frame_metadata_t);
+		auto total_size = metadata_offset + metadata_size;
+		D_ASSERT(total_size <= info.GetBlockSize());
+
+		memset(base_ptr + data_end, 0, metadata_offset - data_end);
+		if (!frames.empty()) {
+			memcpy(base_ptr + metadata_offset, frames.data(), metadata_size);
+		}
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(frames.size()), data_ptr_cast(&header_ptr->frame_count));
+		Store<uint32_t>(NumericCast<uint32_t>(metadata_offset), data_ptr_cast(&header_ptr->frame_metadata_offset));
+
+		if (total_size >= info.GetCompactionFlushLimit()) {
+			// the block is full enough, don't bother compacting it
+			return info.GetBlockSize();
+		}
+		return total_size;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	vector<zstd_frame_metadata_t> frames;
+	//! The total size of the compressed frames in the current segment
+	idx_t data_size;
+
+	// State regarding the pending frame
+	ZSTDFrameBuilder frame;
+	//! The statistics of the pending frame, these are merged into the segment it is written to
+	BaseStatistics frame_stats;
+	duckdb_zstd::ZSTD_CCtx *context;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.AddNull();
+			continue;
+		}
+		state.AddString(data[idx]);
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.FlushFrame();
+	state.Flush(true);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	ZSTDScanState() : context(duckdb_zstd::ZSTD_createDCtx()) {
+	}
+
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	//! Whether this is the state of a scan of the segment
+	bool IsScanOf(ColumnSegment &segment) const {
+		// the scan keeps the block pinned, so the block handle cannot have been reused by a different block
+		return handle.GetBlockHandle() == segment.block && base_ptr == handle.Ptr() + segment.GetBlockOffset();
+	}
+
+	//! Returns the index of the frame that contains the row (relative to the start of the segment)
+	idx_t FindFrame(idx_t row) const {
+		if (current_frame != DConstants::INVALID_INDEX && row >= frame_starts[current_frame] &&
+		    row < frame_starts[current_frame + 1]) {
+			return current_frame;
+		}
+		auto entry = std::upper_bound(frame_starts.begin(), frame_starts.end(), row);
+		D_ASSERT(entry != frame_starts.begin() && entry != frame_starts.end());
+		return NumericCast<idx_t>(entry - frame_starts.begin()) - 1;
+	}
+
+	//! Decompresses the frame, unless it is the currently loaded frame
+	void LoadFrame(idx_t frame_idx) {
+		if (frame_idx == current_frame) {
+			return;
+		}
+		auto &metadata = frames[frame_idx];
+		// every frame gets a new buffer, as the vectors of earlier scans can still reference the previous one
+		frame_buffer = make_buffer<VectorBuffer>(idx_t(metadata.uncompressed_size));
+		auto result = duckdb_zstd::ZSTD_decompressDCtx(context, frame_buffer->GetData(), metadata.uncompressed_size,
+		                                               base_ptr + metadata.compressed_offset, metadata.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(result)) {
+			throw IOException("ZSTD string decompression failed: %s", duckdb_zstd::ZSTD_getErrorName(result));
+		}
+		if (result != metadata.uncompressed_size) {
+			throw IOException("ZSTD string decompression failed: unexpected frame size");
+		}
+
+		// the frame starts with the lengths of the strings, followed by the string data
+		auto lengths = frame_buffer->GetData();
+		string_offsets.resize(metadata.row_count + 1);
+		string_offsets[0] = metadata.row_count * sizeof(uint32_t);
+		for (idx_t i = 0; i < metadata.row_count; i++) {
+			string_offsets[i + 1] = string_offsets[i] + Load<uint32_t>(lengths + i * sizeof(uint32_t));
+		}
+		D_ASSERT(string_offsets[metadata.row_count] == metadata.uncompressed_size);
+		current_frame = frame_idx;
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+	data_ptr_t base_ptr;
+	vector<zstd_frame_metadata_t> frames;
+	//! The first row of every frame, followed by the row count of the segment
+	vector<idx_t> frame_starts;
+
+	idx_t current_frame = DConstants::INVALID_INDEX;
+	//! The decompressed data of the current frame
+	buffer_ptr<VectorBuffer> frame_buffer;
+	//! The offsets of the strings of the current frame in the frame buffer
+	vector<uint32_t> string_offsets;
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	state->base_ptr = state->handle.Ptr() + segment.GetBlockOffset();
+
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(state->base_ptr);
+	auto frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+	auto metadata_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_metadata_offset));
+	state->frames.resize(frame_count);
+	if (frame_count > 0) {
+		memcpy(state->frames.data(), state->base_ptr + metadata_offset, frame_count * sizeof(zstd_frame_metadata_t));
+	}
+
+	state->frame_starts.reserve(frame_count + 1);
+	state->frame_starts.push_back(0);
+	for (auto &frame : state->frames) {
+		state->frame_starts.push_back(state->frame_starts.back() + frame.row_count);
+	}
+	return std::move(state);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                   idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		scan_state.LoadFrame(scan_state.FindFrame(row));
+		auto frame_start = scan_state.frame_starts[scan_state.current_frame];
+		auto frame_end = scan_state.frame_starts[scan_state.current_frame + 1];
+		auto frame_data = char_ptr_cast(scan_state.frame_buffer->GetData());
+
+		auto frame_scan_count = MinValue<idx_t>(scan_count - scanned, frame_end - row);
+		auto offsets = scan_state.string_offsets.data() + (row - frame_start);
+		for (idx_t i = 0; i < frame_scan_count; i++) {
+			auto length = offsets[i + 1] - offsets[i];
+			result_data[result_offset + scanned + i] = string_t(frame_data + offsets[i], length);
+		}
+		// the strings point into the frame buffer: keep it alive as long as the result vector
+		StringVector::AddBuffer(result, scan_state.frame_buffer);
+		scanned += frame_scan_count;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	// we decompress the entire frame that contains the row - the scan state is kept in the fetch state, so that
+	// consecutive fetches from the segment (e.g., of an index lookup) neither set it up again nor decompress the
+	// frame again
+	auto &scan_state_p = state.segment_states[&segment];
+	if (!scan_state_p || !scan_state_p->Cast<ZSTDScanState>().IsScanOf(segment)) {
+		scan_state_p = StringInitScan(segment);
+	}
+	auto &scan_state = scan_state_p->Cast<ZSTDScanState>();
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	scan_state.LoadFrame(scan_state.FindFrame(row));
+
+	auto frame_row = row - scan_state.frame_starts[scan_state.current_frame];
+	auto offset = scan_state.string_offsets[frame_row];
+	auto length = scan_state.string_offsets[frame_row + 1] - offset;
+	auto frame_data = char_ptr_cast(scan_state.frame_buffer->GetData());
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = StringVector::AddStringOrBlob(result, frame_data + offset, length);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const CompressionInfo &info) {
+	return info.GetPhysicalType() == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -403,6 +403,15 @@ bool LocalStorage::ChangesMade() noexcept {
 	return !table_manager.IsEmpty();
 }
 
+bool LocalStorage::Scan(DataTable &table, const vector<column_t> &column_ids,
+                        const std::function<bool(DataChunk &chunk)> &fun) {
+	auto storage = table_manager.GetStorage(table);
+	if (!storage) {
+		return true;
+	}
+	return storage->row_groups->Scan(transaction, column_ids, fun);
+}
+
 bool LocalStorage::Find(DataTable &table) {
 	return table_manager.GetStorage(table) != nullptr;
 }
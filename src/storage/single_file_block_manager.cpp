@@ -457,7 +457,26 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	// read the buffer from disk
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
+	VerifyBlocks(buffer, location, block_count);
+}
+
+void SingleFileBlockManager::BatchReadBlocks(vector<BlockRun> &runs) {
+	vector<FileReadRequest> requests;
+	requests.reserve(runs.size());
+	for (auto &run : runs) {
+		D_ASSERT(run.start_block >= 0);
+		D_ASSERT(run.block_count >= 1);
+		auto &buffer = *run.buffer;
+		requests.emplace_back(buffer.InternalBuffer(), buffer.AllocSize(), GetBlockLocation(run.start_block));
+	}
+	// read the buffers from disk
+	handle->BatchRead(requests);
+	for (idx_t i = 0; i < runs.size(); i++) {
+		VerifyBlocks(*runs[i].buffer, requests[i].location, runs[i].block_count);
+	}
+}
 
+void SingleFileBlockManager::VerifyBlocks(FileBuffer &buffer, uint64_t location, idx_t block_count) const {
 	// for each of the blocks - verify the checksum
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
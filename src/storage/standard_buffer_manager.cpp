@@ -2,6 +2,7 @@
 
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
@@ -57,6 +58,8 @@ StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
 	temporary_directory.path = std::move(tmp);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		evicted_data_per_tag[i] = 0;
+		buffer_hits_per_tag[i] = 0;
+		buffer_misses_per_tag[i] = 0;
 	}
 }
 
@@ -196,52 +199,83 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-                                      block_id_t first_block, block_id_t last_block) {
+                                      const vector<BlockRun> &runs) {
 	auto &block_manager = handles[0]->block_manager;
-	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
-#ifndef DUCKDB_ALTERNATIVE_VERIFY
-	if (block_count == 1) {
-		// prefetching with block_count == 1 has no performance impact since we can't batch reads
-		// skip the prefetch in this case
-		// we do it anyway if alternative_verify is on for extra testing
-		return;
-	}
-#endif
 
-	// allocate a buffer to hold the data of all of the blocks
-	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
-	// perform a batch read of the blocks into the buffer
-	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+	// the runs are read in batches, so that the intermediate buffers of only a single batch are alive at a time
+	// a batch holds at most a ring's worth of runs, and its intermediate buffers may take up at most half of the
+	// memory that is still available - the other half is needed for the blocks that are loaded from them
+	const auto block_size = block_manager.GetBlockSize();
+	vector<BufferHandle> intermediate_buffers;
+	vector<BlockRun> buffer_runs;
+	idx_t batch_start = 0;
+	while (batch_start < runs.size()) {
+		// release the buffers of the previous batch before looking at the available memory
+		intermediate_buffers.clear();
+		buffer_runs.clear();
+		const auto used_memory = GetUsedMemory();
+		const auto max_memory = GetMaxMemory();
+		const auto batch_memory = used_memory < max_memory ? (max_memory - used_memory) / 2 : 0;
+		// a batch always contains at least one run
+		idx_t batch_end = batch_start + 1;
+		idx_t batch_size = runs[batch_start].block_count * block_size;
+		while (batch_end < runs.size() && batch_end - batch_start < IOUring::RING_DEPTH) {
+			const auto run_size = runs[batch_end].block_count * block_size;
+			if (batch_size + run_size > batch_memory) {
+				break;
+			}
+			batch_size += run_size;
+			batch_end++;
+		}
+		// allocate a buffer to hold the data of the blocks of each run
+		for (idx_t run_idx = batch_start; run_idx < batch_end; run_idx++) {
+			auto &run = runs[run_idx];
+			intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, run.block_count * block_size));
+			buffer_runs.emplace_back(intermediate_buffers.back().GetFileBuffer(), run.start_block, run.block_count);
+		}
+		// perform a batch read of the runs at once
+		block_manager.BatchReadBlocks(buffer_runs);
+		LoadBlocks(handles, load_map, buffer_runs);
+		batch_start = batch_end;
+	}
+}
 
+void StandardBufferManager::LoadBlocks(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+                                       vector<BlockRun> &buffer_runs) {
+	auto &block_manager = handles[0]->block_manager;
 	// the blocks are read - now we need to assign them to the individual blocks
-	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
-		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
-		auto entry = load_map.find(block_id);
-		D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
-		auto &handle = handles[entry->second];
-
-		// reserve memory for the block
-		idx_t required_memory = handle->memory_usage;
-		unique_ptr<FileBuffer> reusable_buffer;
-		auto reservation =
-		    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
-		                       StringUtil::BytesToHumanReadableString(required_memory));
-		// now load the block from the buffer
-		// note that we discard the buffer handle - we do not keep it around
-		// the prefetching relies on the block handle being pinned again during the actual read before it is evicted
-		BufferHandle buf;
-		{
-			lock_guard<mutex> lock(handle->lock);
-			if (handle->state == BlockState::BLOCK_LOADED) {
-				// the block is loaded already by another thread - free up the reservation and continue
-				reservation.Resize(0);
-				continue;
+	for (auto &run : buffer_runs) {
+		auto &buffer = *run.buffer;
+		for (idx_t block_idx = 0; block_idx < run.block_count; block_idx++) {
+			block_id_t block_id = run.start_block + NumericCast<block_id_t>(block_idx);
+			auto entry = load_map.find(block_id);
+			D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
+			auto &handle = handles[entry->second];
+
+			// reserve memory for the block
+			idx_t required_memory = handle->memory_usage;
+			unique_ptr<FileBuffer> reusable_buffer;
+			auto reservation =
+			    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
+			                       StringUtil::BytesToHumanReadableString(required_memory));
+			// now load the block from the buffer
+			// note that we discard the buffer handle - we do not keep it around
+			// the prefetching relies on the block handle being pinned again during the actual read before it is
+			// evicted
+			BufferHandle buf;
+			{
+				lock_guard<mutex> lock(handle->lock);
+				if (handle->state == BlockState::BLOCK_LOADED) {
+					// the block is loaded already by another thread - free up the reservation and continue
+					reservation.Resize(0);
+					continue;
+				}
+				auto block_ptr = buffer.InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
+				buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
+				handle->readers = 1;
+				handle->memory_charge = std::move(reservation);
+				handle->prefetched = true;
 			}
-			auto block_ptr =
-			    intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
-			buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
-			handle->readers = 1;
-			handle->memory_charge = std::move(reservation);
 		}
 	}
 }
@@ -261,29 +295,30 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
-	block_id_t first_block = -1;
-	block_id_t previous_block_id = -1;
+	// figure out the runs of adjacent blocks
+	vector<BlockRun> runs;
 	for (auto &entry : to_be_loaded) {
-		if (previous_block_id < 0) {
-			// this the first block we are seeing
-			first_block = entry.first;
-			previous_block_id = first_block;
-		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
-			previous_block_id = entry.first;
-		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
-
-			// set the first_block and previous_block_id to the current block
-			first_block = entry.first;
-			previous_block_id = entry.first;
+		if (!runs.empty()) {
+			auto &run = runs.back();
+			if (run.start_block + UnsafeNumericCast<block_id_t>(run.block_count) == entry.first) {
+				// this block is adjacent to the previous block - add it to the run
+				run.block_count++;
+				continue;
+			}
 		}
+		// this block is not adjacent to the previous block - start a new run
+		runs.emplace_back(entry.first, 1);
+	}
+#ifndef DUCKDB_ALTERNATIVE_VERIFY
+	if (runs.size() == 1 && runs[0].block_count == 1) {
+		// prefetching a single block has no performance impact since we can't batch reads
+		// skip the prefetch in this case
+		// we do it anyway if alternative_verify is on for extra testing
+		return;
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+#endif
+	// read all runs in one batch, so that the reads can be served concurrently
+	BatchRead(handles, to_be_loaded, runs);
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -299,6 +334,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			RecordBufferHit(*handle);
 			handle->readers++;
 			buf = handle->Load(handle);
 		}
@@ -319,12 +355,14 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			RecordBufferHit(*handle);
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load(handle);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
+			buffer_misses_per_tag[uint8_t(handle->tag)]++;
 			handle->readers = 1;
 			buf = handle->Load(handle, std::move(reusable_buffer));
 			handle->memory_charge = std::move(reservation);
@@ -346,6 +384,14 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	return buf;
 }
 
+void StandardBufferManager::RecordBufferHit(BlockHandle &handle) {
+	if (handle.eviction_seq_num == 0) {
+		// the block has never been unpinned, i.e., it was just created: this is not a hit
+		return;
+	}
+	buffer_hits_per_tag[uint8_t(handle.tag)]++;
+}
+
 void StandardBufferManager::PurgeQueue(FileBufferType type) {
 	buffer_pool.PurgeQueue(type);
 }
@@ -408,6 +454,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_hits_per_tag[k].load();
+		info.buffer_misses = buffer_misses_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -37,6 +37,12 @@ void ArrayColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnSc
 	child_column->InitializePrefetch(prefetch_state, scan_state.child_states[1], rows * array_size);
 }
 
+void ArrayColumnData::InitializeColumnPrefetch(PrefetchState &prefetch_state) {
+	ColumnData::InitializeColumnPrefetch(prefetch_state);
+	validity.InitializeColumnPrefetch(prefetch_state);
+	child_column->InitializeColumnPrefetch(prefetch_state);
+}
+
 void ArrayColumnData::InitializeScan(ColumnScanState &state) {
 	// initialize the validity segment
 	D_ASSERT(state.child_states.size() == 2);
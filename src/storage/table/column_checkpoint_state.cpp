@@ -56,6 +56,8 @@ void PartialBlockForCheckpoint::Flush(const idx_t free_space_left) {
 
 	for (idx_t i = 0; i < segments.size(); i++) {
 		auto &segment = segments[i];
+		// the segment can be scanned while it is flushed (e.g., by the transaction that writes it optimistically)
+		segment.data.IncrementVersion();
 		if (i == 0) {
 			// the first segment is converted to persistent - this writes the data for ALL segments to disk
 			D_ASSERT(segment.offset_in_block == 0);
@@ -23,7 +23,7 @@ namespace duckdb {
 ColumnData::ColumnData(BlockManager &block_manager, DataTableInfo &info, idx_t column_index, idx_t start_row,
                        LogicalType type_p, optional_ptr<ColumnData> parent)
     : start(start_row), count(0), block_manager(block_manager), info(info), column_index(column_index),
-      type(std::move(type_p)), parent(parent), allocation_size(0) {
+      type(std::move(type_p)), parent(parent), allocation_size(0), version(0) {
 	if (!parent) {
 		stats = make_uniq<SegmentStatistics>(type);
 	}
@@ -114,7 +114,7 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 	}
 	if (!scan_state.initialized) {
 		// need to prefetch for the current segment if we have not yet initialized the scan for this segment
-		scan_state.current->InitializePrefetch(prefetch_state, scan_state);
+		scan_state.current->InitializePrefetch(prefetch_state);
 	}
 	idx_t row_index = scan_state.row_index;
 	while (remaining > 0) {
@@ -126,22 +126,33 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 			if (!next) {
 				break;
 			}
-			next->InitializePrefetch(prefetch_state, scan_state);
+			next->InitializePrefetch(prefetch_state);
 			current_segment = next;
 		}
 	}
 }
 
-idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
-	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
-		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
+void ColumnData::InitializeColumnPrefetch(PrefetchState &prefetch_state) {
+	auto segment = data.GetRootSegment();
+	while (segment) {
+		segment->InitializePrefetch(prefetch_state);
+		segment = data.GetNextSegment(segment);
 	}
+}
+
+void ColumnData::BeginScanVector(ColumnScanState &state) {
 	state.previous_states.clear();
+	if (state.initialized && state.version != version) {
+		// the segments were written to disk since the scan of the segment was initialized: the scan state can refer to
+		// the old block of the segment - re-initialize it
+		state.initialized = false;
+	}
 	if (!state.initialized) {
 		D_ASSERT(state.current);
 		state.current->InitializeScan(state);
 		state.internal_index = state.current->start;
 		state.initialized = true;
+		state.version = version;
 	}
 	D_ASSERT(data.HasSegment(state.current));
 	D_ASSERT(state.internal_index <= state.row_index);
@@ -149,6 +160,13 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		state.current->Skip(state);
 	}
 	D_ASSERT(state.current->type == type);
+}
+
+idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
+	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
+	}
+	BeginScanVector(state);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
 		D_ASSERT(state.row_index >= state.current->start &&
@@ -178,6 +196,7 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 			state.previous_states.emplace_back(std::move(state.scan_state));
 			state.current = next;
 			state.current->InitializeScan(state);
+			state.version = version;
 			state.segment_checked = false;
 			D_ASSERT(state.row_index >= state.current->start &&
 			         state.row_index <= state.current->start + state.current->count);
@@ -187,6 +206,31 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	return initial_remaining - remaining;
 }
 
+void ColumnData::ScanVectorFiltered(ColumnScanState &state, Vector &result, idx_t scan_count, SelectionVector &sel,
+                                    idx_t &sel_count, const TableFilter &filter) {
+	BeginScanVector(state);
+	D_ASSERT(state.row_index + scan_count <= state.current->start + state.current->count);
+	state.current->Filter(state, scan_count, result, sel, sel_count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+}
+
+bool ColumnData::CanSelectVector(ColumnScanState &state, idx_t target_count) {
+	if (state.scan_options && state.scan_options->force_fetch_row) {
+		return false;
+	}
+	return GetVectorScanType(state, target_count) == ScanVectorType::SCAN_ENTIRE_VECTOR && state.current->CanSelect();
+}
+
+void ColumnData::SelectVector(ColumnScanState &state, Vector &result, idx_t target_count, const SelectionVector &sel,
+                              idx_t sel_count) {
+	BeginScanVector(state);
+	D_ASSERT(state.row_index + target_count <= state.current->start + state.current->count);
+	state.current->Select(state, target_count, result, sel, sel_count);
+	state.row_index += target_count;
+	state.internal_index = state.row_index;
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 	lock_guard<mutex> update_guard(update_lock);
 	return updates ? updates->GetStatistics() : nullptr;
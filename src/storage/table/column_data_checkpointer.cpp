@@ -1,4 +1,5 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/function/compression/compression.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -110,6 +111,16 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method != CompressionType::COMPRESSION_ZSTD &&
+	    !config.options.serialization_compatibility.Compare(ZSTDFun::MINIMUM_SERIALIZATION_VERSION)) {
+		// older versions cannot read ZSTD segments: unless the storage compatibility version allows it, ZSTD is only
+		// used when it is forced
+		for (auto &compression_function : compression_functions) {
+			if (compression_function && compression_function->type == CompressionType::COMPRESSION_ZSTD) {
+				compression_function = nullptr;
+			}
+		}
+	}
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
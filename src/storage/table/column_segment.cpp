@@ -6,6 +6,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -101,7 +102,7 @@ ColumnSegment::~ColumnSegment() {
 //===--------------------------------------------------------------------===//
 // Scan
 //===--------------------------------------------------------------------===//
-void ColumnSegment::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &) {
+void ColumnSegment::InitializePrefetch(PrefetchState &prefetch_state) {
 	if (!block || block->BlockId() >= MAXIMUM_BLOCK) {
 		// not an on-disk block
 		return;
@@ -255,6 +256,56 @@ void ColumnSegment::CommitDropSegment() {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Filter Compressed
+//===--------------------------------------------------------------------===//
+//! Whether the filter can be evaluated without the validity of the rows: this is the case if it never holds for NULL
+static bool IsNullRejectingFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (!IsNullRejectingFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (!IsNullRejectingFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ColumnSegment::CanFilter(const TableFilter &filter) const {
+	// the validity of the rows is stored separately: the compressed data only knows about the values
+	return function.get().filter && IsNullRejectingFilter(filter);
+}
+
+void ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &sel_count, const TableFilter &filter) {
+	D_ASSERT(CanFilter(filter));
+	function.get().filter(*this, state, scan_count, result, sel, sel_count, filter);
+}
+
+bool ColumnSegment::CanSelect() const {
+	return function.get().select;
+}
+
+void ColumnSegment::Select(ColumnScanState &state, idx_t scan_count, Vector &result, const SelectionVector &sel,
+                           idx_t sel_count) {
+	D_ASSERT(CanSelect());
+	function.get().select(*this, state, scan_count, result, sel, sel_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Filter Selection
 //===--------------------------------------------------------------------===//
@@ -516,6 +567,15 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		auto child_filter = dynamic_filter.GetFilter();
+		if (!child_filter) {
+			// the filter has not been set (yet): all tuples pass
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *child_filter, scan_count, approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -43,6 +43,12 @@ void ListColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnSca
 	child_column->InitializePrefetch(prefetch_state, scan_state.child_states[1], rows * rows_per_list);
 }
 
+void ListColumnData::InitializeColumnPrefetch(PrefetchState &prefetch_state) {
+	ColumnData::InitializeColumnPrefetch(prefetch_state);
+	validity.InitializeColumnPrefetch(prefetch_state);
+	child_column->InitializeColumnPrefetch(prefetch_state);
+}
+
 void ListColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -21,6 +21,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 
 namespace duckdb {
@@ -232,6 +233,20 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	return true;
 }
 
+void RowGroup::InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state) {
+	auto &column_ids = state.GetColumnIds();
+	auto filters = state.GetFilters();
+	if (filters && !CheckZonemap(*filters, column_ids)) {
+		// the row group will be skipped by the scan
+		return;
+	}
+	for (auto &column : column_ids) {
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			GetColumn(column).InitializeColumnPrefetch(prefetch_state);
+		}
+	}
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -394,6 +409,13 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 		}
 		return max_count;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto child_filter = filter.Cast<DynamicFilter>().GetFilter();
+		if (!child_filter) {
+			return state.current->start + state.current->count;
+		}
+		return GetFilterScanCount(state, *child_filter);
+	}
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
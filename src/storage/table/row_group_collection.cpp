@@ -11,7 +11,9 @@
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
@@ -169,15 +171,112 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.prefetch_collection = this;
+	state.prefetch_index = 0;
+	state.prefetched_blocks.clear();
+}
+
+//! Loads the blocks of the row groups ahead of a table scan, so that the I/O overlaps with the scan
+class RowGroupPrefetchTask : public ExecutorTask {
+public:
+	RowGroupPrefetchTask(Executor &executor, BufferManager &buffer_manager, vector<shared_ptr<BlockHandle>> blocks_p)
+	    : ExecutorTask(executor, nullptr), buffer_manager(buffer_manager), blocks(std::move(blocks_p)) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		if (executor.HasError() || executor.IsCancelled()) {
+			// the query does not need the blocks anymore
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		try {
+			buffer_manager.Prefetch(blocks);
+		} catch (std::exception &ex) {
+			// prefetching is only a performance suggestion - if it fails (e.g., because we are out of memory),
+			// the scan loads the blocks itself and deals with any error
+			ErrorData error(ex);
+			if (Exception::InvalidatesDatabase(error.Type())) {
+				throw;
+			}
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	BufferManager &buffer_manager;
+	vector<shared_ptr<BlockHandle>> blocks;
+};
+
+void RowGroupCollection::PrefetchRowGroups(ClientContext &context, ParallelCollectionScanState &state,
+                                           CollectionScanState &scan_state, idx_t begin, idx_t end) {
+	// figure out which blocks of each row group the scan is going to read
+	// we only need to load the blocks that are not in memory yet
+	map<idx_t, vector<shared_ptr<BlockHandle>>> row_group_blocks;
+	vector<shared_ptr<BlockHandle>> blocks;
+	auto row_group = row_groups->GetSegmentByIndex(NumericCast<int64_t>(begin));
+	for (idx_t index = begin; index < end && row_group && row_group->start < state.max_row; index++) {
+		PrefetchState prefetch_state;
+		row_group->InitializePrefetch(scan_state, prefetch_state);
+		auto &unloaded_blocks = row_group_blocks[row_group->index];
+		for (auto &block : prefetch_state.blocks) {
+			if (block->IsUnloaded()) {
+				unloaded_blocks.push_back(block);
+				blocks.push_back(std::move(block));
+			}
+		}
+		row_group = row_groups->GetNextSegment(row_group);
+	}
+	if (blocks.empty()) {
+		return;
+	}
+	auto &buffer_manager = block_manager.buffer_manager;
+	// every thread prefetches at most a quarter of the memory that is available to it, so that the prefetched
+	// blocks do not evict the blocks that the other operators of the query are working on
+	auto prefetch_size = blocks.size() * block_manager.GetBlockAllocSize();
+	if (prefetch_size > buffer_manager.GetQueryMaxMemory() / 4) {
+		return;
+	}
+	buffer_manager.GetPrefetchStatistics().scheduled_blocks += blocks.size();
+	{
+		lock_guard<mutex> l(state.lock);
+		for (auto &entry : row_group_blocks) {
+			state.prefetched_blocks[entry.first] = std::move(entry.second);
+		}
+	}
+
+	auto &executor = Executor::Get(context);
+	auto task = make_shared_ptr<RowGroupPrefetchTask>(executor, buffer_manager, std::move(blocks));
+	TaskScheduler::GetScheduler(context).ScheduleTask(executor.GetToken(), std::move(task));
+}
+
+void RowGroupCollection::RecordPrefetchResult(const vector<shared_ptr<BlockHandle>> &blocks) {
+	idx_t hits = 0;
+	idx_t misses = 0;
+	for (auto &block : blocks) {
+		if (block->IsUnloaded()) {
+			misses++;
+		} else if (block->ConsumePrefetched()) {
+			// blocks that were loaded by someone else in the meantime are not hits of the prefetch
+			hits++;
+		}
+	}
+	auto &statistics = block_manager.buffer_manager.GetPrefetchStatistics();
+	statistics.hits += hits;
+	statistics.misses += misses;
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
+	// prefetching only makes sense if the blocks are stored on disk
+	const auto prefetch_lookahead =
+	    block_manager.InMemory() ? 0 : ClientConfig::GetConfig(context).table_scan_prefetch_lookahead;
 	while (true) {
 		idx_t vector_index;
 		idx_t max_row;
 		RowGroupCollection *collection;
 		RowGroup *row_group;
+		vector<shared_ptr<BlockHandle>> prefetched_blocks;
+		idx_t prefetch_begin = 0;
+		idx_t prefetch_end = 0;
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
@@ -206,16 +305,39 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
+			if (prefetch_lookahead > 0 && vector_index == 0) {
+				if (state.prefetch_collection != collection) {
+					// the prefetch index refers to the row groups of another collection
+					state.prefetch_collection = collection;
+					state.prefetch_index = 0;
+					state.prefetched_blocks.clear();
+				}
+				auto entry = state.prefetched_blocks.find(row_group->index);
+				if (entry != state.prefetched_blocks.end()) {
+					prefetched_blocks = std::move(entry->second);
+					state.prefetched_blocks.erase(entry);
+				}
+				// prefetch the row groups up to "lookahead" row groups after this one that have not been prefetched
+				prefetch_begin = MaxValue<idx_t>(state.prefetch_index, row_group->index + 1);
+				prefetch_end = row_group->index + prefetch_lookahead + 1;
+				state.prefetch_index = MaxValue<idx_t>(state.prefetch_index, prefetch_end);
+			}
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
 
+		if (prefetch_begin < prefetch_end) {
+			PrefetchRowGroups(context, state, scan_state, prefetch_begin, prefetch_end);
+		}
 		// initialize the scan for this row group
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
 		if (!need_to_scan) {
 			// skip this row group
 			continue;
 		}
+		if (!prefetched_blocks.empty()) {
+			RecordPrefetchResult(prefetched_blocks);
+		}
 		return true;
 	}
 	lock_guard<mutex> l(state.lock);
@@ -227,7 +349,11 @@ bool RowGroupCollection::Scan(DuckTransaction &transaction, const vector<column_
                               const std::function<bool(DataChunk &chunk)> &fun) {
 	vector<LogicalType> scan_types;
 	for (idx_t i = 0; i < column_ids.size(); i++) {
-		scan_types.push_back(types[column_ids[i]]);
+		if (column_ids[i] == COLUMN_IDENTIFIER_ROW_ID) {
+			scan_types.push_back(LogicalType::ROW_TYPE);
+		} else {
+			scan_types.push_back(types[column_ids[i]]);
+		}
 	}
 	DataChunk chunk;
 	chunk.Initialize(GetAllocator(), scan_types);
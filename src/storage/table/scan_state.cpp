@@ -72,7 +72,8 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), processed_rows(0), prefetch_collection(nullptr),
+      prefetch_index(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
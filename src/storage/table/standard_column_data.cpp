@@ -65,6 +65,11 @@ void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, Colum
 	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
 }
 
+void StandardColumnData::InitializeColumnPrefetch(PrefetchState &prefetch_state) {
+	ColumnData::InitializeColumnPrefetch(prefetch_state);
+	validity.InitializeColumnPrefetch(prefetch_state);
+}
+
 void StandardColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -89,6 +94,53 @@ idx_t StandardColumnData::Scan(TransactionData transaction, idx_t vector_index,
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	auto target_count = GetVectorCount(vector_index);
+	if (GetVectorScanType(state, target_count) != ScanVectorType::SCAN_ENTIRE_VECTOR ||
+	    (state.scan_options && state.scan_options->force_fetch_row) || !state.current->CanFilter(filter)) {
+		// the filter can only be evaluated on the compressed data if the vector is read from a single segment
+		ColumnData::Select(transaction, vector_index, state, result, sel, s_count, filter);
+		return;
+	}
+	// evaluate the filter on the compressed data of the segment
+	ScanVectorFiltered(state, result, target_count, sel, s_count, filter);
+	validity.Scan(transaction, vector_index, state.child_states[0], result, target_count);
+	if (s_count == 0) {
+		return;
+	}
+	// the filter never holds for NULL values, remove these from the selection
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(target_count, vdata);
+	if (vdata.validity.AllValid()) {
+		return;
+	}
+	SelectionVector valid_sel(s_count);
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < s_count; i++) {
+		const auto idx = sel.get_index(i);
+		valid_sel.set_index(valid_count, idx);
+		valid_count += vdata.validity.RowIsValid(vdata.sel->get_index(idx));
+	}
+	sel.Initialize(valid_sel);
+	s_count = valid_count;
+}
+
+void StandardColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                    Vector &result, SelectionVector &sel, idx_t count) {
+	auto target_count = GetVectorCount(vector_index);
+	auto &validity_state = state.child_states[0];
+	if (count == target_count || !CanSelectVector(state, target_count) ||
+	    !validity.CanSelectVector(validity_state, target_count)) {
+		ColumnData::FilterScan(transaction, vector_index, state, result, sel, count);
+		return;
+	}
+	// only decompress the rows that passed the filters
+	SelectVector(state, result, target_count, sel, count);
+	validity.SelectVector(validity_state, result, target_count, sel, count);
+}
+
 idx_t StandardColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates,
                                         idx_t target_count) {
 	D_ASSERT(state.row_index == state.child_states[0].row_index);
@@ -75,6 +75,13 @@ void StructColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnS
 	}
 }
 
+void StructColumnData::InitializeColumnPrefetch(PrefetchState &prefetch_state) {
+	validity.InitializeColumnPrefetch(prefetch_state);
+	for (auto &sub_column : sub_columns) {
+		sub_column->InitializeColumnPrefetch(prefetch_state);
+	}
+}
+
 void StructColumnData::InitializeScan(ColumnScanState &state) {
 	D_ASSERT(state.child_states.size() == sub_columns.size() + 1);
 	state.row_index = 0;
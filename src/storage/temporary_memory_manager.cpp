@@ -1,14 +1,17 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           QueryTemporaryMemory &query_memory_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), query_memory(query_memory_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0) {
 }
 
@@ -55,13 +58,39 @@ TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 	return BufferManager::GetBufferManager(context).GetTemporaryMemoryManager();
 }
 
+idx_t TemporaryMemoryManager::GetQueryMemoryLimit(ClientContext &context) {
+	auto &db_config = DBConfig::GetConfig(context);
+	auto &client_config = ClientConfig::GetConfig(context);
+	return MinValue(db_config.options.connection_memory_limit, client_config.query_memory_limit);
+}
+
+vector<QueryTemporaryMemory> TemporaryMemoryManager::GetQueryTemporaryMemory() {
+	auto guard = Lock();
+	vector<QueryTemporaryMemory> result;
+	for (auto &entry : active_queries) {
+		result.push_back(entry.second);
+	}
+	return result;
+}
+
 unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context) {
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
+	auto &query_memory = active_queries[context];
+	if (query_memory.state_count++ == 0) {
+		query_memory.query = context.GetCurrentQuery();
+	}
+	query_memory.memory_limit = GetQueryMemoryLimit(context);
+
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	if (query_memory.memory_limit != DConstants::INVALID_INDEX) {
+		minimum_reservation =
+		    MinValue(minimum_reservation, query_memory.memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	}
+	auto result =
+	    unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, query_memory, minimum_reservation));
 	SetRemainingSize(*result, result->minimum_reservation);
 	SetReservation(*result, result->minimum_reservation);
 	active_states.insert(*result);
@@ -72,15 +101,27 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
+	auto &query_memory = temporary_memory_state.query_memory;
+	query_memory.memory_limit = GetQueryMemoryLimit(context);
+	// the reservation of the other states of the same query
+	auto query_reservation = query_memory.reservation - temporary_memory_state.reservation;
 
 	if (context.config.force_external) {
 		// We're forcing external processing. Give it the minimum
 		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
 	} else if (!has_temporary_directory) {
 		// We cannot offload, so we cannot limit memory usage. Set reservation equal to the remaining size
+		if (query_memory.remaining_size > query_memory.memory_limit) {
+			// the query cannot stay within its quota by spilling: fail it rather than take memory from other queries
+			throw OutOfMemoryException("The operators of this query need %s of memory, which exceeds the memory quota "
+			                           "of the query (%s), and there is no temporary directory to offload data to",
+			                           StringUtil::BytesToHumanReadableString(query_memory.remaining_size),
+			                           StringUtil::BytesToHumanReadableString(query_memory.memory_limit));
+		}
 		SetReservation(temporary_memory_state, temporary_memory_state.remaining_size);
-	} else if (reservation - temporary_memory_state.reservation >= memory_limit) {
-		// We overshot. Set reservation equal to the minimum
+	} else if (reservation - temporary_memory_state.reservation >= memory_limit ||
+	           query_reservation >= query_memory.memory_limit) {
+		// We overshot the memory limit, or the quota of this query. Set reservation equal to the minimum
 		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
 	} else {
 		// The lower bound for the reservation of this state is its minimum reservation
@@ -90,9 +131,11 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// 4. The memory quota of the query that is not reserved by its other states
 		auto upper_bound = MinValue<idx_t>(temporary_memory_state.remaining_size, query_max_memory);
 		auto free_memory = memory_limit - (reservation - temporary_memory_state.reservation);
 		upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * free_memory));
+		upper_bound = MinValue<idx_t>(upper_bound, query_memory.memory_limit - query_reservation);
 
 		if (remaining_size > memory_limit) {
 			// We're processing more data than fits in memory, so we must further limit memory usage.
@@ -109,17 +152,25 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 }
 
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
+	auto &query_memory = temporary_memory_state.query_memory;
 	D_ASSERT(this->remaining_size >= temporary_memory_state.remaining_size);
+	D_ASSERT(query_memory.remaining_size >= temporary_memory_state.remaining_size);
 	this->remaining_size -= temporary_memory_state.remaining_size;
+	query_memory.remaining_size -= temporary_memory_state.remaining_size;
 	temporary_memory_state.remaining_size = new_remaining_size;
 	this->remaining_size += temporary_memory_state.remaining_size;
+	query_memory.remaining_size += temporary_memory_state.remaining_size;
 }
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
+	auto &query_memory = temporary_memory_state.query_memory;
 	D_ASSERT(this->reservation >= temporary_memory_state.reservation);
+	D_ASSERT(query_memory.reservation >= temporary_memory_state.reservation);
 	this->reservation -= temporary_memory_state.reservation;
+	query_memory.reservation -= temporary_memory_state.reservation;
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.reservation;
+	query_memory.reservation += temporary_memory_state.reservation;
 }
 
 void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_state) {
@@ -129,6 +180,17 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
 
+	// the query has no active states anymore: remove it
+	auto &query_memory = temporary_memory_state.query_memory;
+	if (--query_memory.state_count == 0) {
+		for (auto it = active_queries.begin(); it != active_queries.end(); it++) {
+			if (&it->second == &query_memory) {
+				active_queries.erase(it);
+				break;
+			}
+		}
+	}
+
 	Verify();
 }
 
@@ -160,6 +160,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		auto info = reinterpret_cast<AppendInfo *>(data);
 		// mark the tuples as committed
 		info->table->CommitAppend(commit_id, info->start_row, info->count);
+		info->table->GetDataTableInfo()->SetLastCommitId(commit_id);
 		break;
 	}
 	case UndoFlags::DELETE_TUPLE: {
@@ -167,12 +168,14 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		auto info = reinterpret_cast<DeleteInfo *>(data);
 		// mark the tuples as committed
 		info->version_info->CommitDelete(info->vector_idx, commit_id, *info);
+		info->table->GetDataTableInfo()->SetLastCommitId(commit_id);
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
 		// update:
 		auto info = reinterpret_cast<UpdateInfo *>(data);
 		info->version_number = commit_id;
+		info->segment->column_data.GetTableInfo().SetLastCommitId(commit_id);
 		break;
 	}
 	case UndoFlags::SEQUENCE_VALUE: {
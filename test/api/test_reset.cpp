@@ -55,9 +55,12 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_asof_iejoin", {Value(true)}},
 	    {"debug_force_external", {Value(true)}},
 	    {"debug_force_no_cross_product", {Value(true)}},
+	    {"force_index_join", {Value(true)}},
 	    {"debug_force_external", {Value(true)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"enable_join_filter_pushdown", {Value(false)}},
+	    {"enable_top_n_filter_pushdown", {Value(false)}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"enable_macro_dependencies", {Value(true)}},
@@ -79,6 +82,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_object_cache", {true}},
 	    {"enable_profiling", {"json"}},
 	    {"enable_progress_bar", {true}},
+	    {"enable_query_result_cache", {true}},
 	    {"errors_as_json", {true}},
 	    {"explain_output", {{"all", "optimized_only", "physical_only"}}},
 	    {"file_search_path", {"test"}},
@@ -94,6 +98,11 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"merge_join_threshold", {73}},
 	    {"nested_loop_join_threshold", {73}},
 	    {"memory_limit", {"4.0 GiB"}},
+	    {"buffer_eviction_policy", {"2q"}},
+	    {"connection_memory_limit", {"2.0 GiB"}},
+	    {"query_memory_limit", {"1.0 GiB"}},
+	    {"query_priority", {"high"}},
+	    {"query_result_cache_memory_limit", {"16.0 MiB"}},
 	    {"storage_compatibility_version", {"v0.10.0"}},
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
 	    {"null_order", {"nulls_first"}},
@@ -107,6 +116,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"table_scan_prefetch_lookahead", {Value::UBIGINT(7)}},
 	    {"temp_directory", {"tmp"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
@@ -1,4 +1,5 @@
 #include "catch.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "test_helpers.hpp"
 
 #include <thread>
@@ -115,3 +116,154 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+class PriorityTestTask : public Task {
+public:
+	PriorityTestTask(duckdb::vector<QueryPriority> &executed, QueryPriority priority)
+	    : executed(executed), priority(priority) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		executed.push_back(priority);
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	duckdb::vector<QueryPriority> &executed;
+	QueryPriority priority;
+};
+
+TEST_CASE("Test that the scheduler prefers the tasks of high priority producers", "[api]") {
+	// no background threads: the tasks are only executed when we execute them below, in the order of the scheduler
+	DBConfig config;
+	config.options.maximum_threads = 1;
+	DuckDB db(nullptr, &config);
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+
+	duckdb::vector<QueryPriority> executed;
+	auto low = scheduler.CreateProducer(QueryPriority::LOW);
+	auto high = scheduler.CreateProducer(QueryPriority::HIGH);
+	// the low priority tasks are scheduled first
+	for (idx_t i = 0; i < 100; i++) {
+		scheduler.ScheduleTask(*low, make_shared_ptr<PriorityTestTask>(executed, QueryPriority::LOW));
+	}
+	for (idx_t i = 0; i < 100; i++) {
+		scheduler.ScheduleTask(*high, make_shared_ptr<PriorityTestTask>(executed, QueryPriority::HIGH));
+	}
+
+	// while both classes have tasks, the high priority class gets 16 out of every 17 tasks
+	scheduler.ExecuteTasks(34);
+	REQUIRE(executed.size() == 34);
+	idx_t high_count = 0;
+	for (auto &priority : executed) {
+		high_count += priority == QueryPriority::HIGH;
+	}
+	REQUIRE(high_count == 32);
+
+	// the low priority tasks are not starved, and all tasks are executed
+	scheduler.ExecuteTasks(1000);
+	REQUIRE(executed.size() == 200);
+	REQUIRE(executed.back() == QueryPriority::LOW);
+}
+
+class StreamTestTask : public Task {
+public:
+	StreamTestTask(TaskScheduler &scheduler, ProducerToken &producer, duckdb::vector<QueryPriority> &executed)
+	    : scheduler(scheduler), producer(producer), executed(executed) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		executed.push_back(QueryPriority::HIGH);
+		// every high priority task schedules the next one, so there is always a high priority task waiting
+		scheduler.ScheduleTask(producer, make_shared_ptr<StreamTestTask>(scheduler, producer, executed));
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TaskScheduler &scheduler;
+	ProducerToken &producer;
+	duckdb::vector<QueryPriority> &executed;
+};
+
+TEST_CASE("Test that a stream of high priority tasks does not starve low priority producers", "[api]") {
+	DBConfig config;
+	config.options.maximum_threads = 1;
+	DuckDB db(nullptr, &config);
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+
+	duckdb::vector<QueryPriority> executed;
+	auto low = scheduler.CreateProducer(QueryPriority::LOW);
+	auto high = scheduler.CreateProducer(QueryPriority::HIGH);
+	scheduler.ScheduleTask(*high, make_shared_ptr<StreamTestTask>(scheduler, *high, executed));
+	for (idx_t i = 0; i < 5; i++) {
+		scheduler.ScheduleTask(*low, make_shared_ptr<PriorityTestTask>(executed, QueryPriority::LOW));
+	}
+
+	// one out of every 17 tasks is a low priority task, although the high priority producer never runs out of tasks
+	scheduler.ExecuteTasks(5 * 17);
+	REQUIRE(executed.size() == 5 * 17);
+	idx_t low_count = 0;
+	for (idx_t i = 0; i < executed.size(); i++) {
+		if (executed[i] == QueryPriority::LOW) {
+			low_count++;
+			// the low priority tasks are spread out over the stream
+			REQUIRE(i >= (low_count - 1) * 17);
+			REQUIRE(i < low_count * 17);
+		}
+	}
+	REQUIRE(low_count == 5);
+
+	// only the stream is left
+	scheduler.ExecuteTasks(100);
+	for (idx_t i = 5 * 17; i < executed.size(); i++) {
+		REQUIRE(executed[i] == QueryPriority::HIGH);
+	}
+}
+
+static DuckDB *other_database = nullptr;
+
+static int64_t JoinInOtherDatabase(int64_t i) {
+	Connection con(*other_database);
+	auto result = con.Query("SELECT COUNT(*) FROM range(100000) t1(i) JOIN range(100000) t2(i) USING (i)");
+	if (result->HasError()) {
+		return -1;
+	}
+	return result->GetValue(0, 0).GetValue<int64_t>();
+}
+
+static void RunParallelQueries(DuckDB &db, bool &success) {
+	Connection con(db);
+	for (idx_t i = 0; i < 5; i++) {
+		auto result = con.Query("SELECT COUNT(*) FROM range(1000000) t1(i) JOIN range(1000000) t2(i) USING (i)");
+		if (result->HasError() || result->GetValue(0, 0) != Value::BIGINT(1000000)) {
+			success = false;
+		}
+	}
+}
+
+TEST_CASE("Test running parallel queries on multiple databases", "[api]") {
+	DBConfig config;
+	config.options.maximum_threads = 4;
+	DuckDB db1(nullptr, &config);
+	DuckDB db2(nullptr, &config);
+
+	// the worker threads of both databases run queries at the same time
+	bool success1 = true;
+	bool success2 = true;
+	std::thread thread1(RunParallelQueries, std::ref(db1), std::ref(success1));
+	std::thread thread2(RunParallelQueries, std::ref(db2), std::ref(success2));
+	thread1.join();
+	thread2.join();
+	REQUIRE(success1);
+	REQUIRE(success2);
+
+	// the worker threads of one database run queries on the other database: the tasks of these queries must not end
+	// up in the local queues of the worker threads of the first database
+	other_database = &db1;
+	Connection con(db2);
+	con.CreateScalarFunction<int64_t, int64_t>("join_in_other_database", &JoinInOtherDatabase);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl AS SELECT i FROM range(1000000) t(i)"));
+	auto result = con.Query("SELECT SUM(join_in_other_database(i)) FROM tbl WHERE i % 100000 = 0");
+	other_database = nullptr;
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+}
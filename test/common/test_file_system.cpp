@@ -2,6 +2,7 @@
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/fstream.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/common/local_file_system.hpp"
 #include "test_helpers.hpp"
 
@@ -116,3 +117,55 @@ TEST_CASE("absolute paths", "[file_system]") {
 	REQUIRE(fs.NormalizeAbsolutePath(long_path) == "\\\\?\\d:\\very long network\\");
 #endif
 }
+
+static void VerifyBatchRead(FileSystem &fs, FileHandle &handle, const duckdb::vector<int64_t> &test_data) {
+	// read every other chunk of 16 integers, so that the reads do not fit in a single batch of the ring
+	const idx_t chunk_size = 16;
+	duckdb::vector<int64_t> result(test_data.size(), -1);
+	duckdb::vector<FileReadRequest> requests;
+	for (idx_t offset = 0; offset < test_data.size(); offset += 2 * chunk_size) {
+		requests.emplace_back(result.data() + offset, chunk_size * sizeof(int64_t), offset * sizeof(int64_t));
+	}
+	REQUIRE(requests.size() > IOUring::RING_DEPTH);
+	fs.BatchRead(handle, requests);
+	for (idx_t i = 0; i < test_data.size(); i++) {
+		REQUIRE(result[i] == (i % (2 * chunk_size) < chunk_size ? test_data[i] : -1));
+	}
+
+	// a read that goes beyond the end of the file is only served partially, which is an error
+	duckdb::vector<int64_t> tail(2 * chunk_size, -1);
+	const auto tail_location = (test_data.size() - chunk_size) * sizeof(int64_t);
+	requests.emplace_back(tail.data(), tail.size() * sizeof(int64_t), tail_location);
+	REQUIRE_THROWS(fs.BatchRead(handle, requests));
+	REQUIRE(tail[0] == test_data[test_data.size() - chunk_size]);
+}
+
+TEST_CASE("Test batch reads with and without io_uring", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	duckdb::vector<int64_t> test_data;
+	for (int64_t i = 0; i < 64 * INTEGER_COUNT; i++) {
+		test_data.push_back(i);
+	}
+	auto fname = TestCreatePath("test_batch_read");
+	auto handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+	handle->Write(test_data.data(), test_data.size() * sizeof(int64_t), 0);
+	handle.reset();
+	handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ);
+
+	// io_uring is used if the kernel supports it
+	VerifyBatchRead(*fs, *handle, test_data);
+
+	// without io_uring (e.g., because io_uring_setup fails) the reads fall back to regular reads
+	IOUring::SetEnabled(false);
+	REQUIRE(!IOUring::IsSupported());
+	duckdb::vector<int64_t> result(INTEGER_COUNT, -1);
+	duckdb::vector<FileReadRequest> requests;
+	requests.emplace_back(result.data(), INTEGER_COUNT * sizeof(int64_t), 0);
+	REQUIRE(!IOUring::BatchRead(-1, requests));
+	REQUIRE(requests[0].nr_bytes == INTEGER_COUNT * sizeof(int64_t));
+	VerifyBatchRead(*fs, *handle, test_data);
+	IOUring::SetEnabled(true);
+
+	handle.reset();
+	fs->RemoveFile(fname);
+}